@@ -21,6 +21,12 @@
 @endverbatim
  */
 
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 #include "esp_err.h"
@@ -42,6 +48,8 @@
 #define SSD1306_CHAR_HEIGHT ssd1306_dev.font->FontHeight
 #define SSD1306_HEIGHT_CHARS (SSD1306_HEIGHT / SSD1306_CHAR_HEIGHT)
 
+#define SSD1306_PAGES (SSD1306_HEIGHT / 8)
+
 #define SSD1306_X_OFFSET 5
 #define SSD1306_Y_OFFSET 5
 
@@ -67,9 +75,18 @@ struct ssd1306_device {
     uint8_t width;
     uint8_t height;
 
-    uint8_t buffer[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+    // Drawing goes into buffer while the transmit task sends front
+    uint8_t frames[2][SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+    uint8_t *buffer;
+    uint8_t *front;
+    // What the panel shows, updates only send the spans that differ
+    uint8_t shown[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+    uint8_t shown_valid;
 
     i2c_cmd_handle_t i2c_cmd;
+    // Held while the bus is in use, by the transmit task for a whole frame
+    SemaphoreHandle_t bus_lock;
+    TaskHandle_t tx_task;
 
     void (*clear)(void);
     signed char (*update)(void);
@@ -148,6 +165,20 @@ static esp_err_t ssd1306_write_start_stream(void)
     return ssd1306_write_byte(OLED_CONTROL_BYTE_CMD_STREAM);
 }
 
+static esp_err_t ssd1306_write_start_data(void)
+{
+    if (ssd1306_verbose) {
+        ESP_LOGI(__func__, "Starting data stream");
+    }
+
+    esp_err_t ret;
+    if ((ret = ssd1306_write_address()) != ESP_OK) {
+        return ret;
+    }
+
+    return ssd1306_write_byte(OLED_CONTROL_BYTE_DATA_STREAM);
+}
+
 static esp_err_t ssd1306_write_end(void)
 {
     if (ssd1306_verbose) {
@@ -194,25 +225,135 @@ static esp_err_t ssd1306_write_command(uint8_t command)
 
 void ssd1306_fill(void)
 {
-    for (int i = 0; i < sizeof(ssd1306_dev.buffer); i++) {
+    for (int i = 0; i < sizeof(ssd1306_dev.frames[0]); i++) {
         ssd1306_dev.buffer[i] =
             (ssd1306_dev.background == Black) ? 0xFF : 0x00;
     }
 }
 
-signed char ssd1306_update_screen(void)
+static esp_err_t ssd1306_write_window_command(uint8_t command)
 {
-    uint8_t i;
+    ESP_ERROR_CHECK(ssd1306_write_byte(OLED_CONTROL_BYTE_CMD_SINGLE));
+    return ssd1306_write_byte(command);
+}
 
-    for (i = 0; i < 8; i++) {
-        ESP_ERROR_CHECK(ssd1306_write_start_stream());
-        ssd1306_write_command(OLED_CMD_PAGE_START_ADDR + i);
-        ssd1306_write_command(OLED_CMD_PAGE_VERT_RIGHT);
-        i2c_master_write(ssd1306_dev.i2c_cmd,
-                         &ssd1306_dev.buffer[ssd1306_dev.width * i],
-                         ssd1306_dev.width, true);
-        ssd1306_write_end();
+/**
+ * @brief Sends columns start to end of pages first to last in a single
+ * transaction
+ *
+ * The range commands are each sent as a single command, so the data stream
+ * that follows them can take the rest of the transaction. In horizontal
+ * addressing mode the panel wraps the data onto the next page of the window
+ * by itself, the rows are queued straight out of the buffer without copying.
+ */
+static esp_err_t ssd1306_write_window(uint8_t first, uint8_t last,
+                                      uint8_t start, uint8_t end)
+{
+    unsigned int len = end - start + 1;
+    unsigned int offset;
+
+    ESP_ERROR_CHECK(ssd1306_write_address());
+    ssd1306_write_window_command(OLED_CMD_SET_COLUMN_RANGE);
+    ssd1306_write_window_command(start);
+    ssd1306_write_window_command(end);
+    ssd1306_write_window_command(OLED_CMD_SET_PAGE_RANGE);
+    ssd1306_write_window_command(first);
+    ssd1306_write_window_command(last);
+    ssd1306_write_byte(OLED_CONTROL_BYTE_DATA_STREAM);
+
+    for (uint8_t page = first; page <= last; page++) {
+        offset = page * ssd1306_dev.width + start;
+        i2c_master_write(ssd1306_dev.i2c_cmd, &ssd1306_dev.front[offset],
+                         len, true);
+    }
+    ssd1306_write_end();
+
+    for (uint8_t page = first; page <= last; page++) {
+        offset = page * ssd1306_dev.width + start;
+        memcpy(&ssd1306_dev.shown[offset], &ssd1306_dev.front[offset], len);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Sends the part of the front buffer that changed since the last
+ * frame
+ *
+ * The window sent spans the changed pages and, within them, the first to
+ * the last changed column. A whole frame is one transaction of a little
+ * over 1 KB, unchanged frames take no bus time at all.
+ */
+static void ssd1306_send_frame(void)
+{
+    const uint8_t *buf, *shown;
+    int first = SSD1306_PAGES, last = -1;
+    int start = ssd1306_dev.width, end = -1;
+    int col;
+
+    if (!ssd1306_dev.shown_valid) {
+        ssd1306_write_window(0, SSD1306_PAGES - 1, 0, ssd1306_dev.width - 1);
+        ssd1306_dev.shown_valid = 1;
+        return;
     }
+
+    for (int page = 0; page < SSD1306_PAGES; page++) {
+        buf = &ssd1306_dev.front[page * ssd1306_dev.width];
+        shown = &ssd1306_dev.shown[page * ssd1306_dev.width];
+
+        for (col = 0; col < ssd1306_dev.width && buf[col] == shown[col];
+             col++)
+            ;
+        if (col == ssd1306_dev.width) {
+            continue;
+        }
+        if (col < start) {
+            start = col;
+        }
+        for (col = ssd1306_dev.width - 1; buf[col] == shown[col]; col--)
+            ;
+        if (col > end) {
+            end = col;
+        }
+
+        if (page < first) {
+            first = page;
+        }
+        last = page;
+    }
+
+    if (last >= 0) {
+        ssd1306_write_window(first, last, start, end);
+    }
+}
+
+static void ssd1306_tx_task(void *args)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        ssd1306_send_frame();
+        xSemaphoreGive(ssd1306_dev.bus_lock);
+    }
+}
+
+/**
+ * @brief Hands the drawn frame to the transmit task and returns without
+ * waiting for it to be sent
+ *
+ * Only waits if the previous frame is still on the bus, as its buffer
+ * becomes the one drawn into next. Drawing starts over from the frame
+ * before the one handed off, callers are expected to redraw everything.
+ */
+signed char ssd1306_update_screen(void)
+{
+    uint8_t *frame;
+
+    xSemaphoreTake(ssd1306_dev.bus_lock, portMAX_DELAY);
+    frame = ssd1306_dev.front;
+    ssd1306_dev.front = ssd1306_dev.buffer;
+    ssd1306_dev.buffer = frame;
+    xTaskNotifyGive(ssd1306_dev.tx_task);
+
     return 0;
 }
 
@@ -312,36 +453,58 @@ signed char ssd1306_invert_pixel(uint8_t x, uint8_t y)
     return 0;
 }
 
+/**
+ * @brief Draws a glyph a column at a time, every column is shifted down to
+ * the draw cursor and merged a byte at a time into the pages it spans
+ */
 void ssd1306_write_char(char ch)
 {
-    static unsigned short b;
+    const FontDef *font = ssd1306_dev.font;
+    const unsigned char *glyph;
+    uint8_t pages = FontPages(font);
+    uint8_t shift = ssd1306_dev.y % 8;
+    uint64_t mask = ((1ULL << font->FontHeight) - 1) << shift;
+    uint64_t bits, m;
+    uint8_t *dst;
 
     if (ssd1306_dev.width <=
-        (ssd1306_dev.x +
-         ssd1306_dev.font
-         ->FontWidth) /* would print outside of bounds */
-        || ssd1306_dev.height <=
-        (ssd1306_dev.y + ssd1306_dev.font->FontHeight)) {
+        (ssd1306_dev.x + font->FontWidth) /* would print outside of bounds */
+        || ssd1306_dev.height <= (ssd1306_dev.y + font->FontHeight)) {
         return;
     }
 
-    for (unsigned char i = 0; i < ssd1306_dev.font->FontHeight; i++) {
-        b = ssd1306_dev.font
-            ->data[(ch - 32) * ssd1306_dev.font->FontHeight + i];
-        for (unsigned char j = 0; j < ssd1306_dev.font->FontWidth; j++)
-            if ((b << j) & 0x8000)
-                ssd1306_draw_pixel(
-                    ssd1306_dev.x + j, (ssd1306_dev.y + i),
-                    (SSD1306_colour_t)!ssd1306_dev
-                    .background);
-            else
-                ssd1306_draw_pixel(
-                    ssd1306_dev.x + j, (ssd1306_dev.y + i),
-                    (SSD1306_colour_t)
-                    ssd1306_dev.background);
+    if (ch < ' ' || ch > '~') {
+        ch = ' ';
+    }
+    glyph = &font->data[(ch - ' ') * font->FontWidth * pages];
+
+    for (unsigned char j = 0; j < font->FontWidth; j++, glyph += pages) {
+#if SCREEN_INVERTED
+        for (unsigned char i = 0; i < font->FontHeight; i++)
+            ssd1306_draw_pixel(ssd1306_dev.x + j, ssd1306_dev.y + i,
+                               ((glyph[i / 8] >> (i % 8)) & 1) ?
+                               (SSD1306_colour_t)!ssd1306_dev.background :
+                               ssd1306_dev.background);
+#else
+        bits = 0;
+        for (uint8_t p = 0; p < pages; p++) {
+            bits |= (uint64_t)glyph[p] << (8 * p);
+        }
+        // A set bit is a Black pixel, see ssd1306_draw_pixel()
+        if (ssd1306_dev.background == Black) {
+            bits = ~bits;
+        }
+        bits = (bits << shift) & mask;
+
+        dst = &ssd1306_dev.buffer[(ssd1306_dev.y / 8) * ssd1306_dev.width +
+                                  ssd1306_dev.x + j];
+        for (m = mask; m; m >>= 8, bits >>= 8, dst += ssd1306_dev.width) {
+            *dst = (*dst & ~(uint8_t)m) | (uint8_t)bits;
+        }
+#endif
     }
 
-    ssd1306_dev.x += ssd1306_dev.font->FontWidth;
+    ssd1306_dev.x += font->FontWidth;
 }
 
 signed char ssd1306_invert_box(unsigned char x, unsigned char y)
@@ -412,7 +575,7 @@ static esp_err_t ssd1306_i2c_init(void)
         .scl_io_num = PAF_DEF_OLED_SCL_PIN,
         .sda_pullup_en = GPIO_PULLUP_ENABLE,
         .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = 100000,
+        .master.clk_speed = PAF_DEF_I2C_CLK_SPEED,
     };
     ret = i2c_driver_install(PAF_DEF_I2C_NUM, I2C_MODE_MASTER, 0, 0, 0);
     ESP_ERROR_CHECK(i2c_set_pin(PAF_DEF_I2C_NUM, PAF_DEF_OLED_SDA_PIN,
@@ -430,10 +593,12 @@ static esp_err_t ssd1306_i2c_init(void)
 
 signed char ssd1306_set_contrast(unsigned char contrast)
 {
+    xSemaphoreTake(ssd1306_dev.bus_lock, portMAX_DELAY);
     ESP_ERROR_CHECK(ssd1306_write_start_stream());
     ESP_ERROR_CHECK(ssd1306_write_command(OLED_CMD_SET_CONTRAST));
     ESP_ERROR_CHECK(ssd1306_write_command(contrast));
     ESP_ERROR_CHECK(ssd1306_write_end());
+    xSemaphoreGive(ssd1306_dev.bus_lock);
 
     return 0;
 }
@@ -455,11 +620,19 @@ signed char ssd1306_init(unsigned int verbose)
     ssd1306_dev.background = SSD1306_BACKGROUND;
     ssd1306_dev.font = SSD1306_FONT;
 
+    ssd1306_dev.buffer = ssd1306_dev.frames[0];
+    ssd1306_dev.front = ssd1306_dev.frames[1];
+    ssd1306_dev.bus_lock = xSemaphoreCreateBinary();
+    if (!ssd1306_dev.bus_lock) {
+        return -1;
+    }
+
     //Init LCD
     ESP_ERROR_CHECK(ssd1306_write_start_stream());
     ssd1306_write_command(OLED_CMD_DISPLAY_OFF);
+    // The range commands used by updates need horizontal addressing
     ssd1306_write_command(OLED_CMD_SET_MEMORY_ADDR_MODE);
-    ssd1306_write_command(OLED_CMD_PAGE_ADDR_MODE);
+    ssd1306_write_command(OLED_CMD_HORZ_ADDR_MODE);
     ssd1306_write_command(OLED_CMD_PAGE_START_ADDR);
     ssd1306_write_command(OLED_CMD_SET_COM_SCAN_MODE);
     ssd1306_write_command(0x00); //---set low column address
@@ -487,6 +660,12 @@ signed char ssd1306_init(unsigned int verbose)
     ssd1306_write_command(OLED_CMD_DISPLAY_ON);
     ssd1306_write_end();
 
+    xSemaphoreGive(ssd1306_dev.bus_lock);
+    if (xTaskCreate(ssd1306_tx_task, "ssd1306", PAF_DEF_SCREEN_TX_STACK, NULL,
+                    PAF_DEF_SCREEN_TX_PRIORITY, &ssd1306_dev.tx_task) != pdPASS) {
+        return -1;
+    }
+
     ssd1306_clear();
 
     ssd1306_dev.x = 0;
@@ -43,6 +43,7 @@
 
 // Addressing Command Table (pg.30)
 #define OLED_CMD_SET_MEMORY_ADDR_MODE   0x20    // follow with 0x00 = HORZ mode = Behave like a KS108 graphic LCD
+#define OLED_CMD_HORZ_ADDR_MODE         0x00
 #define OLED_CMD_PAGE_ADDR_MODE         0x10
 #define OLED_CMD_PAGE_START_ADDR        0xB0
 #define OLED_CMD_PAGE_VERT_RIGHT        0x01
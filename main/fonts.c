@@ -1,5 +1,5 @@
-
-#include "fonts.h"
+// Row-major source tables, one short per glyph row with the leftmost pixel in
+// bit 15. Not compiled, tools/mkfont.py converts them at build time
 
 static const short Font7x10 [] = {
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // sp
@@ -2,12 +2,17 @@
 #ifndef Fonts
 #define Fonts
 
+// The tables are generated from fonts.c by tools/mkfont.py. Glyphs ' ' to '~'
+// are FontWidth columns of FontPages() bytes each, least significant bit on
+// top, as the SSD1306 lays out its RAM
 typedef struct {
     const char FontWidth;    /*!< Font width in pixels */
     const char FontHeight;   /*!< Font height in pixels */
-    const short *data; /*!< Pointer to data font data array */
+    const unsigned char *data; /*!< Pointer to data font data array */
 } FontDef;
 
+#define FontPages(font) (((font)->FontHeight + 7) / 8)
+
 extern FontDef Font_7x10;
 extern FontDef Font_11x18;
 extern FontDef Font_16x26;
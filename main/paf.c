@@ -27,11 +27,17 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+#include "esp_log.h"
+
 #include "paf_console.h"
+#include "paf_ctrl.h"
 #include "paf_flash.h"
 #include "paf_wifi.h"
 #include "paf_webserver.h"
 #include "paf_led.h"
+#include "paf_seq.h"
+#include "paf_test.h"
+#include "paf_timing.h"
 #include "paf_config.h"
 #include "screen.h"
 #include "paf_gpio.h"
@@ -40,7 +46,19 @@ unsigned int paf_verbose = 1;
 
 void app_main(void)
 {
+    esp_err_t err;
+
     vTaskDelay(pdMS_TO_TICKS(100));
+    paf_flash_init();
+    paf_flash_restore();
+    ESP_ERROR_CHECK(paf_test_init());
+    ESP_ERROR_CHECK(paf_seq_init());
+    ESP_ERROR_CHECK(paf_timing_init());
+    // The LED runs open loop without it
+    if ((err = paf_ctrl_init()) != ESP_OK) {
+        ESP_LOGE(__func__, "Output regulation unavailable\n-> %s",
+                 esp_err_to_name(err));
+    }
     paf_wifi_init_ap();
     paf_webserver_init();
     /** paf_led_init(PAF_DEF_LED_MODE); */
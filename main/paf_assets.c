@@ -0,0 +1,129 @@
+/**
+ * @file paf_assets.c
+ * @date 16 October 2026
+ * @brief Web asset pack stored in its own flash partition
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+
+#include "paf_assets.h"
+#include "paf_config.h"
+
+static const struct paf_assets_header *assets_header = NULL;
+static const struct paf_assets_entry *assets_index = NULL;
+static spi_flash_mmap_handle_t assets_mmap;
+
+esp_err_t paf_assets_init(void)
+{
+    const esp_partition_t *part;
+    const struct paf_assets_header *hdr;
+    uint32_t size;
+    esp_err_t ret;
+
+    part = esp_partition_find_first(PAF_ASSETS_PARTITION_TYPE,
+                                    PAF_ASSETS_PARTITION_SUBTYPE,
+                                    PAF_ASSETS_PARTITION);
+    if (part == NULL) {
+        ESP_LOGE(__func__, "No '%s' partition", PAF_ASSETS_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    if (assets_header) {
+        return ESP_OK;
+    }
+
+    // Map the header first to learn how much of the partition is used
+    if ((ret = esp_partition_mmap(part, 0, sizeof(*hdr),
+                                  SPI_FLASH_MMAP_DATA,
+                                  (const void **)&hdr,
+                                  &assets_mmap)) != ESP_OK) {
+        return ret;
+    }
+
+    if (hdr->magic != PAF_ASSETS_MAGIC ||
+        hdr->version != PAF_ASSETS_VERSION || hdr->size > part->size ||
+        sizeof(*hdr) + hdr->count * sizeof(struct paf_assets_entry) >
+        hdr->size) {
+        ESP_LOGE(__func__, "'%s' holds no valid asset pack",
+                 PAF_ASSETS_PARTITION);
+        spi_flash_munmap(assets_mmap);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    size = hdr->size;
+    spi_flash_munmap(assets_mmap);
+
+    if ((ret = esp_partition_mmap(part, 0, size, SPI_FLASH_MMAP_DATA,
+                                  (const void **)&hdr,
+                                  &assets_mmap)) != ESP_OK) {
+        return ret;
+    }
+
+    assets_index = (const struct paf_assets_entry *)(hdr + 1);
+    for (int i = 0; i < hdr->count; i++) {
+        if (assets_index[i].offset + assets_index[i].length > hdr->size) {
+            ESP_LOGE(__func__, "Asset %.*s exceeds the pack",
+                     PAF_ASSETS_NAME_LEN, assets_index[i].uri);
+            spi_flash_munmap(assets_mmap);
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+    assets_header = hdr;
+
+    ESP_LOGI(__func__, "%u assets, %u bytes mapped", hdr->count,
+             hdr->size);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Looks up the asset served at uri, any query string is ignored
+ */
+esp_err_t paf_assets_find(const char *uri, paf_asset_t *asset)
+{
+    const struct paf_assets_entry *entry;
+    // Cache busting "?v=..." suffixes name the same asset
+    size_t len = strcspn(uri, "?");
+
+    if (!assets_header) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (len > PAF_ASSETS_NAME_LEN) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    for (int i = 0; i < assets_header->count; i++) {
+        entry = &assets_index[i];
+        // Names filling the whole field aren't terminated
+        if (strncmp(uri, entry->uri, len) == 0 &&
+            (len == PAF_ASSETS_NAME_LEN || entry->uri[len] == '\0')) {
+            asset->uri = entry->uri;
+            asset->type = entry->type;
+            asset->data = (const uint8_t *)assets_header + entry->offset;
+            asset->length = entry->length;
+            asset->hash = entry->hash;
+            asset->flags = entry->flags;
+            return ESP_OK;
+        }
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
@@ -0,0 +1,72 @@
+#ifndef __PAF_ASSETS_H__
+#define __PAF_ASSETS_H__
+
+/**
+ * @file paf_assets.h
+ * @date 16 October 2026
+ * @brief Web asset pack stored in its own flash partition
+ *
+ * The pack is built by tools/mkassetpack.py and consists of a header, an
+ * index of paf_assets_entry records and the (gzipped) blobs. All integers
+ * are little endian. The partition is memory mapped through the flash cache
+ * so assets can be sent straight out of flash without a copy in DRAM.
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#define PAF_ASSETS_MAGIC 0x57464150 // "PAFW"
+#define PAF_ASSETS_VERSION 1
+#define PAF_ASSETS_NAME_LEN 32
+
+#define PAF_ASSETS_FLAG_GZIP 0x1
+// The URI changes whenever the content does, so clients may cache it for
+// good. Anything else is revalidated against its ETag on every use
+#define PAF_ASSETS_FLAG_IMMUTABLE 0x2
+
+struct paf_assets_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size; /**< Whole pack including this header */
+} __attribute__((packed));
+
+struct paf_assets_entry {
+    char uri[PAF_ASSETS_NAME_LEN];
+    char type[PAF_ASSETS_NAME_LEN];
+    uint32_t offset; /**< From the start of the pack */
+    uint32_t length;
+    uint32_t hash; /**< FNV-1a of the blob */
+    uint32_t flags;
+} __attribute__((packed));
+
+typedef struct paf_asset {
+    const char *uri;
+    const char *type;
+    const uint8_t *data;
+    size_t length;
+    uint32_t hash;
+    uint32_t flags;
+} paf_asset_t;
+
+esp_err_t paf_assets_init(void);
+esp_err_t paf_assets_find(const char *uri, paf_asset_t *asset);
+
+#endif // __PAF_ASSETS_H__
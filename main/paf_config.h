@@ -15,9 +15,36 @@
 
 
 #define PAF_DEF_LED_GPIO PAF_DEF_LED_8
-#define PAF_DEF_LED_DC (4000)
+// Pin of each LEDC high speed channel, -1 leaves a channel unused. GPIOs 34
+// and 35 are input only and can't drive LEDs 1 and 2
+#define PAF_DEF_LED_CHANNEL_PINS { PAF_DEF_LED_GPIO, PAF_DEF_LED_7, \
+        PAF_DEF_LED_6, PAF_DEF_LED_5, -1, -1, -1, -1 }
+// LEDC timer of each channel, channels sharing a timer share the frequency
+// and get their rising edges staggered over the period
+#define PAF_DEF_LED_CHANNEL_TIMERS { LEDC_TIMER_0, LEDC_TIMER_0, \
+        LEDC_TIMER_0, LEDC_TIMER_0, LEDC_TIMER_1, LEDC_TIMER_1, \
+        LEDC_TIMER_2, LEDC_TIMER_3 }
+// Channels driven by tests that don't name any and by manual control
+#define PAF_DEF_LED_CHANNELS PAF_LED_CH(0)
+#define PAF_DEF_LED_DC (488340) // ppm
 #define PAF_DEF_LED_FREQ (9500)
 #define PAF_DEF_LED_PWM_FADE_TIME (3000)
+// Fewest duty bits a PWM frequency may leave, limits it to APB_CLK_FREQ >> 4
+#define PAF_LED_PWM_MIN_RES 4
+// Highest PWM frequency whose duty cycles the LEDC ISR dithers below a
+// count, it runs once per period so this caps its CPU time. 0 leaves only
+// the 1/16 counts the LEDC dithers itself
+#define PAF_DEF_LED_DITHER_MAX_RATE (10000)
+// Fastest PWM whose commits the LEDC ISR loads on a period boundary. It has to
+// write the registers within the period following an overflow, commits to
+// faster timers are written straight away and one period may run on a mix of
+// old and new parameters
+#define PAF_LED_COMMIT_SYNC_MAX_RATE (100000)
+#define PAF_DEF_PULSE_BACKEND PAF_LED_PULSE_RMT
+// Task logging the LED state changes made from ISRs
+#define PAF_LED_EVENT_STACK 2048
+#define PAF_LED_EVENT_PRIORITY 1
+#define PAF_LED_EVENT_QUEUE_LEN 16
 
 #define PAF_DEF_WIFI_SSID "PAF"
 #define PAF_DEF_WIFI_PASSWORD "paf"
@@ -36,36 +63,120 @@
 #define PAF_WEBSERVER_STACK 4096
 #define PAF_WEBSERVER_PRIORITY 2
 #define PAF_WEBSERVER_CORE tskNO_AFFINITY
+#define PAF_WEBSERVER_CHUNK_SIZE 4096
+// Per request buffer for request bodies and generated responses
+#define PAF_WEBSERVER_SCRATCH_SIZE 256
+// Timing histogram bins sent per chunk, each takes up to 11 bytes
+#define PAF_WEBSERVER_TIMING_BINS_PER_CHUNK 8
+#define PAF_WEBSERVER_WS_MAX_CLIENTS PAF_DEF_WIFI_AP_MAX_CON
+// Minimum time between two telemetry pushes, caps the WebSocket fan-out
+#define PAF_WEBSERVER_WS_MIN_INTERVAL_MS 100
+
+#define PAF_ASSETS_PARTITION "www"
+#define PAF_ASSETS_PARTITION_TYPE 0x40
+#define PAF_ASSETS_PARTITION_SUBTYPE 0x00
 
 #define PAF_CONSOLE_STACK 4096
 #define PAF_CONSOLE_PRIORITY 2
 #define PAF_CONSOLE_CORE tskNO_AFFINITY
 
+#define PAF_FLASH_STACK 3072
+#define PAF_FLASH_PRIORITY 1
+#define PAF_FLASH_CORE tskNO_AFFINITY
+#define PAF_FLASH_PARTITION "paf_nvs"
+#define PAF_FLASH_NAMESPACE "paf"
+// Changes are written once they have settled for PAF_FLASH_SAVE_DELAY_MS,
+// but never later than PAF_FLASH_SAVE_MAX_DELAY_MS after the first one
+#define PAF_FLASH_SAVE_DELAY_MS 2000
+#define PAF_FLASH_SAVE_MAX_DELAY_MS 10000
+
 #define PAF_DEF_OLED_SDA_PIN (21)
 #define PAF_DEF_OLED_SCL_PIN (22)
 #define PAF_DEF_I2C_NUM I2C_NUM_0
+// Fast-mode, the SSD1306 maximum, a full frame takes about 25 ms. Boards
+// with external pull-ups of a few kOhm may opt into fast-mode plus
+// (1000000, about 10 ms a frame), the internal ones are too weak for it
+#define PAF_DEF_I2C_CLK_SPEED 400000
 #define PAF_DEF_SCREEN_PRIORITY 3
 #define PAF_DEF_SCREEN_STACK 4096
+// Sends the frames the screen task draws
+#define PAF_DEF_SCREEN_TX_PRIORITY 2
+#define PAF_DEF_SCREEN_TX_STACK 2048
 
 #define PAF_TEST_TASK_PRIORITY 4
-#define PAF_TEST(FREQ, DC, DUR) {.freq = FREQ, .dc = DC, .duration = DUR},
+#define PAF_TEST_TASK_STACK 2048
+// Rate at which the remaining time is published while a test runs
+#define PAF_TEST_TELEMETRY_PERIOD_MS 500
+#define PAF_TEST_CH(CH, FREQ, DC, DUR) {.freq = FREQ, .dc = DC, \
+        .duration = DUR, .channels = CH},
+#define PAF_TEST(FREQ, DC, DUR) PAF_TEST_CH(PAF_DEF_LED_CHANNELS, FREQ, DC, DUR)
+
+// Upper bound for plans loaded at runtime, see paf_plan.h
+#define PAF_PLAN_MAX_TESTS 4096
+
+// Segment sequencer, see paf_seq.h. The task refills a buffer while the
+// other one plays, so PAF_SEQ_BUF_SEGMENTS * PAF_SEQ_MIN_SEGMENT_US is the
+// time it has to do so
+#define PAF_SEQ_MAX_SEGMENTS 16384
+#define PAF_SEQ_BUF_SEGMENTS 32
+#define PAF_SEQ_MIN_SEGMENT_US 20
+#define PAF_SEQ_TASK_STACK 2048
+#define PAF_SEQ_TASK_PRIORITY 5
+
+// LED edge timing, see paf_timing.h. The capture input is wired back to the
+// LED output, -1 timestamps the edges in the LED ISRs instead
+#define PAF_TIMING_CAPTURE_GPIO -1
+#define PAF_TIMING_RING_LEN 256 // Power of two
+#define PAF_TIMING_BINS 32
+#define PAF_TIMING_BIN_NS 500
+#define PAF_TIMING_POLL_MS 20
+#define PAF_TIMING_TASK_STACK 2048
+#define PAF_TIMING_TASK_PRIORITY 1
+
+// Closed loop regulation of the optical output, see paf_ctrl.h. A
+// photodiode amplifier, low pass filtered well below the PWM frequency,
+// feeds ADC1, sampled by I2S DMA. Each loop step averages one DMA buffer
+#define PAF_CTRL_ADC_CHANNEL ADC1_CHANNEL_0 // GPIO 36
+#define PAF_CTRL_I2S I2S_NUM_0
+#define PAF_CTRL_SAMPLE_RATE 40000
+#define PAF_CTRL_RATE 1000 // Loop steps per second
+#define PAF_CTRL_SAMPLES_PER_STEP (PAF_CTRL_SAMPLE_RATE / PAF_CTRL_RATE)
+#define PAF_CTRL_DMA_BUFS 4
+// Gains in 1/65536 of trim per relative error, checked by tools/pisim
+#define PAF_CTRL_KP 4096
+#define PAF_CTRL_KI 2048
+#define PAF_CTRL_TRIM_MAX 300000 // ppm of the duty cycle
+// Smallest trim change committed, smaller ones are left to build up so ADC
+// noise doesn't recommit the duty cycles every step. tools/pisim reports
+// how often the trim changes
+#define PAF_CTRL_TRIM_DEADBAND 1000 // ppm of the duty cycle
+// Setpoints below this many 1/16 ADC counts are too dim to regulate
+#define PAF_CTRL_MIN_SETPOINT 256
+// Steps not regulated after the setpoint changed or regulation resumed,
+// until the amplifier's low pass and the averaged buffer caught up
+#define PAF_CTRL_SETTLE_STEPS 5
+// Steps whose output is averaged by a calibration
+#define PAF_CTRL_CAL_STEPS 32
+#define PAF_CTRL_TASK_STACK 3072
+#define PAF_CTRL_TASK_PRIORITY 6
+#define PAF_CTRL_CORE 1
 
 #define PAF_TEST_COUNT 15
 #define PAF_DEF_TESTS static struct test_config paf_def_tests[PAF_TEST_COUNT] = { \
-        PAF_TEST(100, 0.5*8191, 500) \
-        PAF_TEST(10, 8191, 1000) \
-        PAF_TEST(1, 8191, 5000) \
-        PAF_TEST(1, 8191, 10000) \
-        PAF_TEST(1, 8191, 30000) \
-        PAF_TEST(0, 8191, 60000) \
-        PAF_TEST(0, 0.1*8191, 60000) \
-        PAF_TEST(0, 0.25*8191, 60000) \
-        PAF_TEST(0, 0.5*8191, 60000) \
-        PAF_TEST(0, 0.75*8191, 60000) \
-        PAF_TEST(10, 8191, 20000) \
-        PAF_TEST(20, 8191, 20000) \
-        PAF_TEST(50, 8191, 20000) \
-        PAF_TEST(0, 0.01*8191, 5000) \
+        PAF_TEST(100, 0.5*PAF_LED_DC_MAX, 500) \
+        PAF_TEST(10, PAF_LED_DC_MAX, 1000) \
+        PAF_TEST(1, PAF_LED_DC_MAX, 5000) \
+        PAF_TEST(1, PAF_LED_DC_MAX, 10000) \
+        PAF_TEST(1, PAF_LED_DC_MAX, 30000) \
+        PAF_TEST(0, PAF_LED_DC_MAX, 60000) \
+        PAF_TEST(0, 0.1*PAF_LED_DC_MAX, 60000) \
+        PAF_TEST(0, 0.25*PAF_LED_DC_MAX, 60000) \
+        PAF_TEST(0, 0.5*PAF_LED_DC_MAX, 60000) \
+        PAF_TEST(0, 0.75*PAF_LED_DC_MAX, 60000) \
+        PAF_TEST(10, PAF_LED_DC_MAX, 20000) \
+        PAF_TEST(20, PAF_LED_DC_MAX, 20000) \
+        PAF_TEST(50, PAF_LED_DC_MAX, 20000) \
+        PAF_TEST(0, 0.01*PAF_LED_DC_MAX, 5000) \
     }
 
 
@@ -33,7 +33,12 @@
 #include "linenoise/linenoise.h"
 
 #include "paf_util.h"
+#include "paf_ctrl.h"
 #include "paf_flash.h"
+#include "paf_led.h"
+#include "paf_plan.h"
+#include "paf_seq.h"
+#include "paf_timing.h"
 #include "paf_config.h"
 
 static xTaskHandle consoleHandle = NULL;
@@ -41,6 +46,11 @@ static xTaskHandle consoleHandle = NULL;
 void register_commands(void)
 {
     register_version();
+    register_plan();
+    register_led();
+    register_seq();
+    register_timing();
+    register_ctrl();
 }
 
 static void initialize_console(void)
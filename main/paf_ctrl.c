@@ -0,0 +1,292 @@
+/**
+ * @file paf_ctrl.c
+ * @date 16 October 2026
+ * @brief Closed loop regulation of the LED's optical output
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_console.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "driver/adc.h"
+#include "driver/i2s.h"
+#include "hal/cpu_hal.h"
+
+#include "paf_config.h"
+#include "paf_ctrl.h"
+#include "paf_led.h"
+#include "paf_pi.h"
+#include "paf_seq.h"
+
+// ADC samples come with the channel in the top 4 bits
+#define PAF_CTRL_SAMPLE_MASK 0xFFF
+#define PAF_CTRL_SAMPLE_FRAC_BITS 4
+#define PAF_CTRL_PERIOD_US (1000000 / PAF_CTRL_RATE)
+
+_Static_assert(PAF_CTRL_SAMPLES_PER_STEP * PAF_CTRL_RATE ==
+               PAF_CTRL_SAMPLE_RATE,
+               "A loop step has to average a whole number of samples");
+
+static paf_pi_loop_t paf_ctrl_loop;
+static paf_ctrl_status_t paf_ctrl_status;
+static uint64_t paf_ctrl_cycles_sum = 0;
+static portMUX_TYPE paf_ctrl_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint16_t paf_ctrl_samples[PAF_CTRL_SAMPLES_PER_STEP];
+static unsigned char paf_ctrl_initd = 0;
+
+/**
+ * @brief Returns the mean of n samples in 1/16 ADC counts
+ */
+static uint32_t paf_ctrl_average(const uint16_t *samples, size_t n)
+{
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        sum += samples[i] & PAF_CTRL_SAMPLE_MASK;
+    }
+
+    return n ? (sum << PAF_CTRL_SAMPLE_FRAC_BITS) / n : 0;
+}
+
+/**
+ * @brief Runs one loop step on the buffer just filled by the DMA, the loop
+ * itself is in paf_pi.c so tools/pisim runs it as well
+ */
+static void paf_ctrl_step(uint32_t measured)
+{
+    unsigned int dc = paf_led_get_dc();
+    unsigned char steady;
+    int32_t trim;
+
+    // Only a steady PWM output can be regulated
+    steady = paf_led_get_led() && !paf_led_get_pulse_selected() &&
+             !paf_seq_is_playing();
+
+    portENTER_CRITICAL(&paf_ctrl_lock);
+    paf_ctrl_status.measured = measured;
+    trim = paf_pi_loop_step(&paf_ctrl_loop, measured, dc, steady);
+    portEXIT_CRITICAL(&paf_ctrl_lock);
+
+    // Only fails while the LED isn't driven by the LEDC
+    paf_led_set_trim(trim);
+}
+
+static void paf_ctrl_task(void *params)
+{
+    int64_t now, last = 0;
+    uint32_t start, cycles;
+    size_t read;
+
+    while (1) {
+        // Paced by the DMA, every buffer is one step
+        if (i2s_read(PAF_CTRL_I2S, paf_ctrl_samples, sizeof(paf_ctrl_samples),
+                     &read, portMAX_DELAY) != ESP_OK || !read) {
+            continue;
+        }
+        start = cpu_hal_get_cycle_count();
+        now = esp_timer_get_time();
+
+        paf_ctrl_step(paf_ctrl_average(paf_ctrl_samples,
+                                       read / sizeof(paf_ctrl_samples[0])));
+
+        cycles = cpu_hal_get_cycle_count() - start;
+        portENTER_CRITICAL(&paf_ctrl_lock);
+        paf_ctrl_status.steps++;
+        if (last && now - last > 2 * PAF_CTRL_PERIOD_US) {
+            paf_ctrl_status.late++;
+        }
+        paf_ctrl_cycles_sum += cycles;
+        if (cycles > paf_ctrl_status.cycles_max) {
+            paf_ctrl_status.cycles_max = cycles;
+        }
+        portEXIT_CRITICAL(&paf_ctrl_lock);
+        last = now;
+    }
+}
+
+esp_err_t paf_ctrl_init(void)
+{
+    const i2s_config_t i2s_config = {
+        .mode = I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN,
+        .sample_rate = PAF_CTRL_SAMPLE_RATE,
+        .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
+        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
+        .communication_format = I2S_COMM_FORMAT_STAND_I2S,
+        .intr_alloc_flags = 0,
+        .dma_buf_count = PAF_CTRL_DMA_BUFS,
+        .dma_buf_len = PAF_CTRL_SAMPLES_PER_STEP,
+        .use_apll = false,
+    };
+    esp_err_t ret;
+
+    if (paf_ctrl_initd) {
+        return ESP_OK;
+    }
+
+    paf_pi_loop_init(&paf_ctrl_loop, PAF_CTRL_KP, PAF_CTRL_KI);
+
+    if ((ret = i2s_driver_install(PAF_CTRL_I2S, &i2s_config, 0, NULL)) !=
+        ESP_OK) {
+        return ret;
+    }
+    if ((ret = i2s_set_adc_mode(ADC_UNIT_1, PAF_CTRL_ADC_CHANNEL)) !=
+        ESP_OK) {
+        return ret;
+    }
+    if ((ret = adc1_config_channel_atten(PAF_CTRL_ADC_CHANNEL,
+                                         ADC_ATTEN_DB_11)) != ESP_OK) {
+        return ret;
+    }
+    if ((ret = i2s_adc_enable(PAF_CTRL_I2S)) != ESP_OK) {
+        return ret;
+    }
+
+    if (xTaskCreatePinnedToCore(paf_ctrl_task, "ctrl", PAF_CTRL_TASK_STACK,
+                                NULL, PAF_CTRL_TASK_PRIORITY, NULL,
+                                PAF_CTRL_CORE) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    paf_ctrl_initd = 1;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Starts or stops regulating, stopping drops the trim. Regulation
+ * needs a calibration, which enabling starts if there is none yet
+ */
+esp_err_t paf_ctrl_enable(unsigned char enable)
+{
+    if (!paf_ctrl_initd) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    portENTER_CRITICAL(&paf_ctrl_lock);
+    paf_pi_loop_enable(&paf_ctrl_loop, enable);
+    portEXIT_CRITICAL(&paf_ctrl_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Takes the output measured over the next PAF_CTRL_CAL_STEPS steady
+ * steps as the output the set duty cycle should give from now on
+ */
+void paf_ctrl_calibrate(void)
+{
+    portENTER_CRITICAL(&paf_ctrl_lock);
+    paf_pi_loop_calibrate(&paf_ctrl_loop);
+    portEXIT_CRITICAL(&paf_ctrl_lock);
+}
+
+/**
+ * @brief Changes the gains, in 1/65536, without disturbing the output
+ */
+void paf_ctrl_set_gains(int32_t kp, int32_t ki)
+{
+    portENTER_CRITICAL(&paf_ctrl_lock);
+    paf_ctrl_loop.pi.kp = kp;
+    paf_ctrl_loop.pi.ki = ki;
+    portEXIT_CRITICAL(&paf_ctrl_lock);
+}
+
+void paf_ctrl_get_status(paf_ctrl_status_t *status)
+{
+    portENTER_CRITICAL(&paf_ctrl_lock);
+    *status = paf_ctrl_status;
+    status->enabled = paf_ctrl_loop.enabled;
+    status->active = paf_ctrl_loop.active;
+    status->calibrating = paf_ctrl_loop.calibrating;
+    status->ref = paf_ctrl_loop.ref;
+    status->setpoint = paf_ctrl_loop.setpoint;
+    status->trim = paf_ctrl_loop.trim;
+    status->kp = paf_ctrl_loop.pi.kp;
+    status->ki = paf_ctrl_loop.pi.ki;
+    status->cycles_mean = paf_ctrl_status.steps ?
+                          paf_ctrl_cycles_sum / paf_ctrl_status.steps : 0;
+    portEXIT_CRITICAL(&paf_ctrl_lock);
+}
+
+static int ctrl_cmd(int argc, char **argv)
+{
+    paf_ctrl_status_t status;
+    long kp, ki;
+    char *end;
+
+    if (argc == 2 && (!strcmp(argv[1], "on") || !strcmp(argv[1], "off"))) {
+        if (paf_ctrl_enable(!strcmp(argv[1], "on")) != ESP_OK) {
+            printf("Regulation is not available\n");
+            return 1;
+        }
+        return 0;
+    }
+    if (argc == 2 && !strcmp(argv[1], "cal")) {
+        paf_ctrl_calibrate();
+        return 0;
+    }
+    if (argc == 4 && !strcmp(argv[1], "gains")) {
+        kp = strtol(argv[2], &end, 0);
+        if (*end || kp < 0) {
+            printf("Invalid kp %s\n", argv[2]);
+            return 1;
+        }
+        ki = strtol(argv[3], &end, 0);
+        if (*end || ki < 0) {
+            printf("Invalid ki %s\n", argv[3]);
+            return 1;
+        }
+        paf_ctrl_set_gains(kp, ki);
+        return 0;
+    }
+    if (argc != 1) {
+        printf("Usage: ctrl [on | off | cal | gains <kp> <ki>]\n");
+        return 1;
+    }
+
+    paf_ctrl_get_status(&status);
+    printf("%s%s%s, trim %d ppm, kp %d, ki %d\n",
+           status.enabled ? "on" : "off",
+           status.active ? ", regulating" : "",
+           status.calibrating ? ", calibrating" : "", status.trim,
+           status.kp, status.ki);
+    printf("ref %u, setpoint %u, measured %u (1/16 counts)\n", status.ref,
+           status.setpoint, status.measured);
+    printf("%u steps, %u late, %u cycles mean, %u max\n", status.steps,
+           status.late, status.cycles_mean, status.cycles_max);
+
+    return 0;
+}
+
+void register_ctrl(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "ctrl",
+        .help = "Show the optical output regulation, switch it on or off, "
+        "calibrate it at the current output or set its gains in 1/65536",
+        .hint = "[on | off | cal | gains <kp> <ki>]",
+        .func = &ctrl_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
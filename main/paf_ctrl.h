@@ -0,0 +1,67 @@
+#ifndef __PAF_CTRL_H__
+#define __PAF_CTRL_H__
+
+/**
+ * @file paf_ctrl.h
+ * @date 16 October 2026
+ * @brief Closed loop regulation of the LED's optical output
+ *
+ * A photodiode, or an LED current sense amplifier, on PAF_CTRL_ADC_CHANNEL
+ * is sampled continuously by the I2S peripheral's ADC DMA. A task pinned to
+ * PAF_CTRL_CORE averages each DMA buffer and runs a PI controller (see
+ * paf_pi.h) on it at PAF_CTRL_RATE. The controller trims the duty cycles
+ * set for the group, see paf_led_set_trim(), so the output follows them
+ * despite the LED heating up or aging.
+ *
+ * The setpoint is the set duty cycle times the output measured per ppm of
+ * duty cycle when the loop was calibrated. Regulation holds while the LED
+ * is off, pulsed or playing a sequence.
+ *
+ * tools/pisim runs the controller against a model of the LED and the
+ * photodiode on the host.
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef struct paf_ctrl_status {
+    unsigned char enabled;
+    unsigned char active; /**< Regulating rather than holding the trim */
+    unsigned char calibrating; /**< Calibration pending or running */
+    uint32_t ref; /**< 1/16 ADC counts at full duty cycle, 0 uncalibrated */
+    uint32_t setpoint; /**< 1/16 ADC counts */
+    uint32_t measured; /**< 1/16 ADC counts */
+    int32_t trim; /**< ppm */
+    int32_t kp;
+    int32_t ki;
+    uint32_t steps;
+    uint32_t late; /**< Steps that started more than a period late */
+    uint32_t cycles_mean; /**< CPU cycles per step */
+    uint32_t cycles_max;
+} paf_ctrl_status_t;
+
+esp_err_t paf_ctrl_init(void);
+esp_err_t paf_ctrl_enable(unsigned char enable);
+void paf_ctrl_calibrate(void);
+void paf_ctrl_set_gains(int32_t kp, int32_t ki);
+void paf_ctrl_get_status(paf_ctrl_status_t *status);
+
+void register_ctrl(void);
+
+#endif // __PAF_CTRL_H__
@@ -22,16 +22,394 @@
 @endverbatim
  */
 
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 #include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp32/rom/crc.h"
+#include "nvs.h"
 #include "nvs_flash.h"
 
+#include "paf_config.h"
+#include "paf_flash.h"
+#include "paf_led.h"
+#include "paf_plan.h"
+#include "paf_test.h"
+
+#define PAF_FLASH_SETTINGS_KEY "settings"
+// Bumped when duty cycles went from 13 bit counts to ppm
+#define PAF_FLASH_SETTINGS_VERSION 2
+#define PAF_FLASH_PLAN_KEY "plan"
+#define PAF_FLASH_PLAN_VERSION 4
+
+#define PAF_FLASH_DIRTY_SETTINGS (1 << 0)
+
+/**
+ * @brief Leads every blob, a blob whose version or CRC does not match is
+ * ignored and the defaults are kept
+ */
+struct paf_flash_blob_header {
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t length; /**< Of the payload following the header */
+    uint32_t crc; /**< crc32_le of the payload */
+};
+
+struct paf_flash_settings_blob {
+    struct paf_flash_blob_header header;
+    uint32_t led_freq;
+    uint32_t led_dc;
+    uint32_t led_duration;
+    uint32_t cur_test;
+    uint8_t auto_skip;
+    uint8_t led_channels; /**< 0 in blobs written before channel groups */
+    uint8_t reserved[2];
+};
+
+// Plans are stored as the raw test_config_t array
+_Static_assert(sizeof(test_config_t) == 5 * sizeof(uint32_t),
+               "test_config_t layout changed, bump PAF_FLASH_PLAN_VERSION");
+
 static char paf_flash_initd = 0;
+static char paf_flash_storage_initd = 0;
+// Set by paf_flash_restore(), saving what it applies would only write back
+// what was just read
+static char paf_flash_restoring = 0;
+static nvs_handle_t paf_flash_handle;
+static TaskHandle_t paf_flash_task_handle = NULL;
+static esp_timer_handle_t paf_flash_timer = NULL;
+static portMUX_TYPE paf_flash_lock = portMUX_INITIALIZER_UNLOCKED;
+static unsigned int paf_flash_dirty = 0;
+static int64_t paf_flash_dirty_since;
 
 int paf_flash_is_initd(void)
 {
     return paf_flash_initd;
 }
 
+static void paf_flash_seal(struct paf_flash_blob_header *header,
+                           uint16_t version, size_t length)
+{
+    header->version = version;
+    header->reserved = 0;
+    header->length = length;
+    header->crc = crc32_le(0, (const uint8_t *)(header + 1), length);
+}
+
+static int paf_flash_blob_valid(const struct paf_flash_blob_header *header,
+                                size_t size, uint16_t version)
+{
+    return size >= sizeof(*header) && header->version == version &&
+           header->length == size - sizeof(*header) &&
+           header->crc == crc32_le(0, (const uint8_t *)(header + 1),
+                                   header->length);
+}
+
+static void paf_flash_write_settings(void)
+{
+    struct paf_flash_settings_blob blob = { 0 };
+    struct paf_test_status status;
+    struct paf_led_settings led;
+    esp_err_t err;
+
+    // Snapshot at write time, so a burst of changes costs one write
+    paf_led_get_settings(&led);
+    paf_test_get_status(&status);
+    blob.led_freq = led.freq;
+    blob.led_dc = led.dc;
+    blob.led_duration = led.duration;
+    blob.cur_test = status.cur_test;
+    blob.auto_skip = status.auto_skip;
+    blob.led_channels = led.channels;
+    paf_flash_seal(&blob.header, PAF_FLASH_SETTINGS_VERSION,
+                   sizeof(blob) - sizeof(blob.header));
+
+    err = nvs_set_blob(paf_flash_handle, PAF_FLASH_SETTINGS_KEY, &blob,
+                       sizeof(blob));
+    if (err != ESP_OK) {
+        ESP_LOGW(__func__, "Couldn't save settings\n-> %s",
+                 esp_err_to_name(err));
+    }
+}
+
+/**
+ * @brief Performs the flash writes, at low priority so the erase latency
+ * never stalls the webserver or test tasks
+ */
+static void paf_flash_task(void *params)
+{
+    unsigned int dirty;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        portENTER_CRITICAL(&paf_flash_lock);
+        dirty = paf_flash_dirty;
+        paf_flash_dirty = 0;
+        portEXIT_CRITICAL(&paf_flash_lock);
+
+        if (dirty & PAF_FLASH_DIRTY_SETTINGS) {
+            paf_flash_write_settings();
+        }
+        if (dirty) {
+            nvs_commit(paf_flash_handle);
+        }
+    }
+}
+
+static void paf_flash_timer_cb(void *arg)
+{
+    xTaskNotifyGive(paf_flash_task_handle);
+}
+
+/**
+ * @brief Marks data as dirty and (re)arms the write timer
+ *
+ * Every change pushes the write back by PAF_FLASH_SAVE_DELAY_MS, but by no
+ * more than PAF_FLASH_SAVE_MAX_DELAY_MS after the first unsaved change.
+ */
+static void paf_flash_schedule(unsigned int dirty)
+{
+    int64_t now = esp_timer_get_time();
+    unsigned char rearm;
+
+    portENTER_CRITICAL(&paf_flash_lock);
+    if (!paf_flash_dirty) {
+        paf_flash_dirty_since = now;
+    }
+    paf_flash_dirty |= dirty;
+    rearm = now - paf_flash_dirty_since <
+            PAF_FLASH_SAVE_MAX_DELAY_MS * 1000LL;
+    portEXIT_CRITICAL(&paf_flash_lock);
+
+    if (rearm) {
+        esp_timer_stop(paf_flash_timer);
+    }
+    // Fails harmlessly if the timer is still armed
+    esp_timer_start_once(paf_flash_timer, PAF_FLASH_SAVE_DELAY_MS * 1000);
+}
+
+/**
+ * @brief Schedules the manual LED settings, the current test and the auto
+ * skip setting to be saved
+ */
+void paf_flash_save_settings(void)
+{
+    if (paf_flash_storage_initd && !paf_flash_restoring) {
+        paf_flash_schedule(PAF_FLASH_DIRTY_SETTINGS);
+    }
+}
+
+/**
+ * @brief Saves a plan, the tests are copied so the caller keeps ownership.
+ * NULL removes the stored plan.
+ *
+ * Plans are written right away in the caller's context rather than
+ * debounced like the settings, so the caller learns whether the plan
+ * survives a reboot. The partition can't hold two copies of a plan of
+ * PAF_PLAN_MAX_TESTS, and NVS writes the new copy before it erases the
+ * old one, so the stored plan is erased first. A failed write then leaves
+ * the built-in plan to boot with rather than a stale one.
+ */
+esp_err_t paf_flash_save_plan(const struct tests *plan)
+{
+    struct paf_flash_blob_header *blob = NULL;
+    size_t length = 0;
+    uint32_t caps;
+    esp_err_t err;
+
+    if (!paf_flash_storage_initd) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (paf_flash_restoring) {
+        return ESP_OK;
+    }
+
+    if (plan) {
+        length = plan->num_tests * sizeof(test_config_t);
+        blob = paf_plan_alloc(sizeof(*blob) + length, &caps);
+        if (!blob) {
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(blob + 1, plan->tests, length);
+        paf_flash_seal(blob, PAF_FLASH_PLAN_VERSION, length);
+    }
+
+    err = nvs_erase_key(paf_flash_handle, PAF_FLASH_PLAN_KEY);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        err = ESP_OK;
+    }
+    if (err == ESP_OK && blob) {
+        err = nvs_set_blob(paf_flash_handle, PAF_FLASH_PLAN_KEY, blob,
+                           sizeof(*blob) + length);
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(paf_flash_handle);
+    }
+    heap_caps_free(blob);
+
+    if (err != ESP_OK) {
+        ESP_LOGW(__func__, "Couldn't save plan\n-> %s", esp_err_to_name(err));
+    }
+    else {
+        ESP_LOGI(__func__, "Plan of %u bytes saved",
+                 plan ? sizeof(*blob) + length : 0);
+    }
+
+    return err;
+}
+
+static esp_err_t paf_flash_load_settings(struct paf_flash_settings_blob *blob)
+{
+    size_t size = sizeof(*blob);
+    esp_err_t err;
+
+    err = nvs_get_blob(paf_flash_handle, PAF_FLASH_SETTINGS_KEY, blob, &size);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    return paf_flash_blob_valid(&blob->header, size,
+                                PAF_FLASH_SETTINGS_VERSION) ?
+           ESP_OK : ESP_ERR_INVALID_CRC;
+}
+
+/**
+ * @brief Loads the stored plan, the tests are allocated for paf_test to take
+ * ownership of
+ */
+static esp_err_t paf_flash_load_plan(struct tests *plan)
+{
+    struct paf_flash_blob_header *blob;
+    size_t size, length;
+    uint32_t caps;
+    esp_err_t err;
+
+    err = nvs_get_blob(paf_flash_handle, PAF_FLASH_PLAN_KEY, NULL, &size);
+    if (err != ESP_OK) {
+        return err;
+    }
+    length = size - sizeof(*blob);
+    if (size <= sizeof(*blob) || length % sizeof(test_config_t) ||
+        length > PAF_PLAN_MAX_TESTS * sizeof(test_config_t)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    blob = paf_plan_alloc(size, &caps);
+    if (!blob) {
+        return ESP_ERR_NO_MEM;
+    }
+    err = nvs_get_blob(paf_flash_handle, PAF_FLASH_PLAN_KEY, blob, &size);
+    if (err == ESP_OK &&
+        !paf_flash_blob_valid(blob, size, PAF_FLASH_PLAN_VERSION)) {
+        err = ESP_ERR_INVALID_CRC;
+    }
+    if (err != ESP_OK) {
+        heap_caps_free(blob);
+        return err;
+    }
+
+    // The tests are moved to the start of the allocation so that paf_test
+    // can free them
+    memmove(blob, blob + 1, length);
+    plan->tests = (test_config_t *)blob;
+    plan->num_tests = length / sizeof(test_config_t);
+    plan->cur_test = 0;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Applies the stored plan and settings, meant to be called once at
+ * boot before the webserver and console start. The saves applying them
+ * would schedule are dropped
+ */
+void paf_flash_restore(void)
+{
+    struct paf_flash_settings_blob settings;
+    struct paf_led_settings led;
+    struct tests plan;
+    esp_err_t err;
+
+    if (!paf_flash_storage_initd) {
+        return;
+    }
+
+    paf_flash_restoring = 1;
+    err = paf_flash_load_plan(&plan);
+    if (err == ESP_OK) {
+        paf_test_set_plan(&plan);
+    }
+    else if (err != ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGW(__func__, "Stored plan ignored\n-> %s",
+                 esp_err_to_name(err));
+    }
+
+    err = paf_flash_load_settings(&settings);
+    if (err == ESP_OK) {
+        led.freq = settings.led_freq;
+        led.dc = settings.led_dc;
+        led.duration = settings.led_duration;
+        led.channels = settings.led_channels ? settings.led_channels :
+                       PAF_DEF_LED_CHANNELS;
+        if (paf_led_load_settings(&led) != ESP_OK) {
+            ESP_LOGW(__func__, "Stored LED settings ignored");
+        }
+        paf_test_load_settings(settings.cur_test, settings.auto_skip);
+        ESP_LOGI(__func__, "Restored test #%u {freq: %u, dc: %u, dur: %u}",
+                 settings.cur_test, led.freq, led.dc, led.duration);
+    }
+    else if (err != ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGW(__func__, "Stored settings ignored\n-> %s",
+                 esp_err_to_name(err));
+    }
+    paf_flash_restoring = 0;
+}
+
+static esp_err_t paf_flash_init_storage(void)
+{
+    const esp_timer_create_args_t timer_args = {
+        .callback = &paf_flash_timer_cb,
+        .name = "paf_flash",
+    };
+    esp_err_t ret;
+
+    ret = nvs_flash_init_partition(PAF_FLASH_PARTITION);
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES ||
+        ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase_partition(PAF_FLASH_PARTITION));
+        ret = nvs_flash_init_partition(PAF_FLASH_PARTITION);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ret = nvs_open_from_partition(PAF_FLASH_PARTITION, PAF_FLASH_NAMESPACE,
+                                  NVS_READWRITE, &paf_flash_handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ret = esp_timer_create(&timer_args, &paf_flash_timer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    if (xTaskCreatePinnedToCore(paf_flash_task, "flash", PAF_FLASH_STACK,
+                                NULL, PAF_FLASH_PRIORITY,
+                                &paf_flash_task_handle,
+                                PAF_FLASH_CORE) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
 int paf_flash_init(void)
 {
     if (!paf_flash_initd) {
@@ -43,6 +421,16 @@ int paf_flash_init(void)
         }
         ESP_ERROR_CHECK(ret);
         paf_flash_initd = 1;
+
+        // Losing persistence is not fatal, the defaults are used instead
+        ret = paf_flash_init_storage();
+        if (ret != ESP_OK) {
+            ESP_LOGE(__func__, "Settings storage unavailable\n-> %s",
+                     esp_err_to_name(ret));
+        }
+        else {
+            paf_flash_storage_initd = 1;
+        }
     }
 
     return 0;
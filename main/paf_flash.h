@@ -24,7 +24,14 @@
 @endverbatim
  */
 
+#include "esp_err.h"
+
+#include "paf_test.h"
+
 int paf_flash_is_initd(void);
 int paf_flash_init(void);
+void paf_flash_restore(void);
+void paf_flash_save_settings(void);
+esp_err_t paf_flash_save_plan(const struct tests *plan);
 
 #endif // __PAF_FLASH_H__
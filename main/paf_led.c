@@ -22,47 +22,88 @@
 @endverbatim
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_attr.h"
+#include "esp_console.h"
+#include "esp_intr_alloc.h"
 #include "esp_log.h"
 
 #include "driver/gpio.h"
 #include "driver/ledc.h"
+#include "driver/rmt.h"
 #include "driver/timer.h"
+#include "hal/gpio_ll.h"
+#include "hal/ledc_ll.h"
+#include "hal/rmt_ll.h"
+#include "soc/soc.h"
 
 
 #include "paf_config.h"
 #include "paf_led.h"
+#include "paf_timing.h"
 
 #define PAF_LED_TIMER LEDC_TIMER_0
 #define PAF_LED_MODE LEDC_HIGH_SPEED_MODE
 #define PAF_LED_GPIO_PIN PAF_DEF_LED_GPIO
-#define PAF_LED_CHANNEL LEDC_CHANNEL_0
 
+// Widest LEDC duty_num, duty_cycle and duty_scale fields
+#define PAF_LED_FADE_MAX 1023
 
+#define PAF_LED_RMT_CHANNEL RMT_CHANNEL_0
+// 1 us RMT ticks, long enough periods for 1 Hz pulses fit in one block
+// Full APB rate, coarsened per pulse train by paf_led_rmt_div()
+#define PAF_LED_RMT_CLK_DIV 1
+#define PAF_LED_RMT_MAX_CLK_DIV 255
+// TIMER backend prescaler, the smallest the timers take
+#define PAF_LED_PULSE_TIMER_DIV 2
+#define PAF_LED_RMT_MAX_DURATION 32767
+// One block, less the end marker
+#define PAF_LED_RMT_MAX_ITEMS 63
+
+
+// The duty resolution is picked for each frequency, see paf_led_freq_res()
 ledc_timer_config_t ledc_timer = {
     .duty_resolution = LEDC_TIMER_13_BIT,
     .freq_hz = PAF_DEF_LED_FREQ,
     .speed_mode = PAF_LED_MODE,
     .timer_num = PAF_LED_TIMER,
-    .clk_cfg = LEDC_AUTO_CLK,
+    // The commit ISR works out dividers of the APB clock
+    .clk_cfg = LEDC_USE_APB_CLK,
 };
 
-ledc_channel_config_t ledc_channel = {
-    .channel = PAF_LED_CHANNEL,
-    .duty = 0,
-    .gpio_num = PAF_DEF_LED_GPIO,
-    .speed_mode = PAF_LED_MODE,
-    .hpoint = 0,
-    .timer_sel = PAF_LED_TIMER,
-};
+// Read from the ISRs, so kept out of flash
+static DRAM_ATTR int paf_led_pins[PAF_LED_CHANNELS] = PAF_DEF_LED_CHANNEL_PINS;
+static DRAM_ATTR ledc_timer_t paf_led_timers[PAF_LED_CHANNELS] =
+    PAF_DEF_LED_CHANNEL_TIMERS;
 
 struct led_config {
     char led_status;
     char ledc_initd;
-    unsigned int ledc_dc;
+    unsigned int ledc_dc; /**< Last duty cycle set for the whole group */
     unsigned int ledc_freq;
-
+    unsigned int channels; /**< Group switched on and off, PAF_LED_CH() */
+    unsigned int ch_dc[PAF_LED_CHANNELS]; /**< ppm */
+    unsigned int ch_duty[PAF_LED_CHANNELS]; /**< ch_dc in 1/16 counts */
+    uint32_t ch_fine[PAF_LED_CHANNELS]; /**< ch_dc in 1/256 counts */
+    unsigned int ch_hpoint[PAF_LED_CHANNELS];
+    unsigned int seq_max_dc; /**< Highest level of a playing sequence or 0 */
+    uint32_t timer_div[LEDC_TIMER_MAX]; /**< Staged 10.8 clock dividers */
+    uint32_t timer_res[LEDC_TIMER_MAX]; /**< Staged duty resolutions */
+    unsigned int dirty_timers; /**< Timers whose divider changed */
+    unsigned int dither_max_rate; /**< Hz, 0 stops the ISR dithering */
+    int32_t trim; /**< Closed loop correction of the duty cycles, ppm */
 } static ledc_cfg = { .ledc_dc = PAF_DEF_LED_DC,
-                      .ledc_freq = PAF_DEF_LED_FREQ
+                      .ledc_freq = PAF_DEF_LED_FREQ,
+                      .channels = PAF_DEF_LED_CHANNELS,
+                      .dither_max_rate = PAF_DEF_LED_DITHER_MAX_RATE,
                     };
 
 struct pulsGen_config {
@@ -88,117 +129,909 @@ unsigned int led_onDuration_ms = 1000;
 
 static paf_led_mode_t led_mode = PAF_LED_MODE_NOTSET;
 
+// LED state changes made from ISRs, logged by paf_led_event_task()
+typedef enum paf_led_event {
+    PAF_LED_EVENT_ON = 0,
+    PAF_LED_EVENT_OFF,
+    PAF_LED_EVENT_TEST_END,
+    PAF_LED_EVENT_APPLIED, /**< A commit is in effect on all its timers */
+} paf_led_event_t;
+
+static QueueHandle_t paf_led_event_queue = NULL;
+static volatile unsigned int paf_led_events_dropped = 0;
+
+// LEDC overflow interrupt of each high speed timer
+#define PAF_LED_OVF_INT(T) (1 << (T))
+#define PAF_LED_OVF_INTS ((1 << LEDC_TIMER_MAX) - 1)
+
+// The duty registers hold 1/16 counts, the LEDC itself lengthens the right
+// share of periods by a count. Where the frequency allows the LEDC ISR
+// dithers PAF_LED_DITHER_BITS below whole counts instead, it writes whole
+// counts so the LEDC's own fractions don't apply
+#define PAF_LED_DUTY_FRAC_BITS 4
+#define PAF_LED_DITHER_BITS 8
+#define PAF_LED_DITHER_MASK ((1 << PAF_LED_DITHER_BITS) - 1)
+#define paf_led_ll_set_duty(CH, DUTY) \
+    (LEDC.channel_group[PAF_LED_MODE].channel[CH].duty.duty = (DUTY))
+
+/**
+ * @brief PWM settings committed by paf_led_commit(), loaded by the LEDC ISR
+ * at the next overflow of each timer
+ */
+struct paf_led_pwm {
+    uint32_t div[LEDC_TIMER_MAX];
+    uint32_t res[LEDC_TIMER_MAX];
+    uint32_t duty[PAF_LED_CHANNELS];
+    uint32_t hpoint[PAF_LED_CHANNELS];
+    unsigned int channels; /**< Channels whose duty is loaded */
+    unsigned int timers; /**< Timers yet to overflow */
+    uint32_t seq;
+    unsigned char quiet; /**< Applied without an event, see paf_led_set_trim() */
+};
+
+static DRAM_ATTR struct paf_led_pwm paf_led_pending;
+static DRAM_ATTR portMUX_TYPE paf_led_pwm_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t paf_led_commit_seq = 0;
+// Rate each timer runs at as of its last commit, in Hz
+static uint32_t paf_led_timer_rate[LEDC_TIMER_MAX];
+static volatile uint32_t paf_led_applied_seq = 0;
+static paf_led_applied_cb_t paf_led_applied_cb = NULL;
+static intr_handle_t paf_led_ledc_intr;
+
+// Serialises the tasks changing ledc_cfg and committing it, the console,
+// the web server, tests, the sequencer and the regulation. Recursive, the
+// setters build on each other
+static SemaphoreHandle_t paf_led_mutex = NULL;
+static StaticSemaphore_t paf_led_mutex_buf;
+
+/**
+ * @brief Takes paf_led_mutex, created on first use as settings may be
+ * restored before paf_led_init()
+ */
+static void paf_led_lock(void)
+{
+    if (!paf_led_mutex) {
+        portENTER_CRITICAL(&paf_led_pwm_lock);
+        if (!paf_led_mutex) {
+            paf_led_mutex =
+                xSemaphoreCreateRecursiveMutexStatic(&paf_led_mutex_buf);
+        }
+        portEXIT_CRITICAL(&paf_led_pwm_lock);
+    }
+    xSemaphoreTakeRecursive(paf_led_mutex, portMAX_DELAY);
+}
+
+static void paf_led_unlock(void)
+{
+    xSemaphoreGiveRecursive(paf_led_mutex);
+}
+
+/**
+ * @brief First order sigma-delta modulator of a channel dithered by the LEDC
+ * ISR, guarded by paf_led_pwm_lock
+ */
+struct paf_led_dither {
+    uint32_t duty; /**< Whole counts, in 1/16 counts */
+    uint16_t frac; /**< 1/256 counts */
+    uint16_t acc;
+};
+
+static DRAM_ATTR struct paf_led_dither paf_led_dither[PAF_LED_CHANNELS];
+static DRAM_ATTR unsigned int paf_led_dither_channels = 0;
+static DRAM_ATTR unsigned int paf_led_dither_timers = 0;
+// Dithered channels of a group switched off from ISR context, they are
+// dithered again once it is switched back on
+static DRAM_ATTR unsigned int paf_led_dither_parked = 0;
+
+/**
+ * @brief Changes the dithered channels from ISR context, keeping their
+ * modulators, called with paf_led_pwm_lock held
+ *
+ * Timers no longer dithered lose their overflow interrupt at their next
+ * overflow, see paf_led_ledc_isr().
+ */
+static inline void IRAM_ATTR paf_led_isr_set_dither(unsigned int channels)
+{
+    unsigned int timers = 0;
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (channels & PAF_LED_CH(ch)) {
+            timers |= 1 << paf_led_timers[ch];
+        }
+    }
+    paf_led_dither_channels = channels;
+    paf_led_dither_timers = timers;
+    LEDC.int_ena.val |= timers;
+}
+
+static void IRAM_ATTR paf_led_isr_post(paf_led_event_t event,
+                                       BaseType_t *higher_prio_woken)
+{
+    uint8_t ev = event;
+
+    if (!paf_led_event_queue ||
+        xQueueSendFromISR(paf_led_event_queue, &ev,
+                          higher_prio_woken) != pdTRUE) {
+        paf_led_events_dropped++;
+    }
+}
+
+static void paf_led_post(paf_led_event_t event)
+{
+    uint8_t ev = event;
+
+    if (!paf_led_event_queue ||
+        xQueueSend(paf_led_event_queue, &ev, 0) != pdTRUE) {
+        paf_led_events_dropped++;
+    }
+}
+
+/**
+ * @brief Switches the LED on from ISR context
+ *
+ * Only writes the LEDC or GPIO registers and lives in IRAM, so it can be
+ * used while the flash cache is disabled. Logging is left to the LED event
+ * task.
+ */
+void IRAM_ATTR paf_led_isr_set_on(BaseType_t *higher_prio_woken)
+{
+    portENTER_CRITICAL_ISR(&paf_led_pwm_lock);
+    if (paf_led_dither_parked) {
+        paf_led_isr_set_dither(paf_led_dither_channels |
+                               paf_led_dither_parked);
+        paf_led_dither_parked = 0;
+    }
+    portEXIT_CRITICAL_ISR(&paf_led_pwm_lock);
+
+    // if/else rather than a switch, whose jump table could end up in flash
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (!(ledc_cfg.channels & PAF_LED_CH(ch))) {
+            continue;
+        }
+        if (led_mode == PAF_LED_MODE_PWM) {
+            if (ledc_cfg.ledc_initd) {
+                ledc_ll_set_hpoint(&LEDC, PAF_LED_MODE, ch,
+                                   ledc_cfg.ch_hpoint[ch]);
+                paf_led_ll_set_duty(ch, ledc_cfg.ch_duty[ch]);
+                ledc_ll_set_duty_start(&LEDC, PAF_LED_MODE, ch, true);
+                ledc_ll_set_sig_out_en(&LEDC, PAF_LED_MODE, ch, true);
+            }
+        }
+        else if (led_mode == PAF_LED_MODE_GPIO) {
+            gpio_ll_set_level(&GPIO, paf_led_pins[ch], 1);
+        }
+    }
+    paf_timing_isr_led_edge(1);
+    ledc_cfg.led_status = 1;
+    paf_led_isr_post(PAF_LED_EVENT_ON, higher_prio_woken);
+}
+
+/**
+ * @brief Switches the LED off from ISR context, see paf_led_isr_set_on()
+ */
+void IRAM_ATTR paf_led_isr_set_off(BaseType_t *higher_prio_woken)
+{
+    // A commit still waiting for its period must not switch them back on,
+    // nor may the dither
+    portENTER_CRITICAL_ISR(&paf_led_pwm_lock);
+    paf_led_pending.channels &= ~ledc_cfg.channels;
+    if (paf_led_dither_channels & ledc_cfg.channels) {
+        paf_led_dither_parked |= paf_led_dither_channels & ledc_cfg.channels;
+        paf_led_isr_set_dither(paf_led_dither_channels & ~ledc_cfg.channels);
+    }
+    portEXIT_CRITICAL_ISR(&paf_led_pwm_lock);
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (!(ledc_cfg.channels & PAF_LED_CH(ch))) {
+            continue;
+        }
+        if (led_mode == PAF_LED_MODE_PWM) {
+            if (ledc_cfg.ledc_initd) {
+                ledc_ll_set_idle_level(&LEDC, PAF_LED_MODE, ch, 0);
+                ledc_ll_set_sig_out_en(&LEDC, PAF_LED_MODE, ch, false);
+            }
+        }
+        else if (led_mode == PAF_LED_MODE_GPIO) {
+            gpio_ll_set_level(&GPIO, paf_led_pins[ch], 0);
+        }
+    }
+    paf_timing_isr_led_edge(0);
+    ledc_cfg.led_status = 0;
+    paf_led_isr_post(PAF_LED_EVENT_OFF, higher_prio_woken);
+}
+
+/**
+ * @brief Loads a plain duty cycle, in 1/16 counts, into a channel,
+ * replacing any fade
+ */
+static inline void IRAM_ATTR paf_led_isr_load_duty(int ch, uint32_t duty,
+        uint32_t hpoint)
+{
+    ledc_ll_set_hpoint(&LEDC, PAF_LED_MODE, ch, hpoint);
+    paf_led_ll_set_duty(ch, duty);
+    ledc_ll_set_duty_direction(&LEDC, PAF_LED_MODE, ch, 1);
+    ledc_ll_set_duty_num(&LEDC, PAF_LED_MODE, ch, 1);
+    ledc_ll_set_duty_cycle(&LEDC, PAF_LED_MODE, ch, 1);
+    ledc_ll_set_duty_scale(&LEDC, PAF_LED_MODE, ch, 0);
+    ledc_ll_set_duty_start(&LEDC, PAF_LED_MODE, ch, true);
+    ledc_ll_set_sig_out_en(&LEDC, PAF_LED_MODE, ch, true);
+}
+
+/**
+ * @brief Loads timer t's share of the pending commit, called with
+ * paf_led_pwm_lock held
+ */
+static inline void IRAM_ATTR paf_led_isr_load_timer(int t)
+{
+    ledc_ll_set_duty_resolution(&LEDC, PAF_LED_MODE, t,
+                                paf_led_pending.res[t]);
+    ledc_ll_set_clock_divider(&LEDC, PAF_LED_MODE, t, paf_led_pending.div[t]);
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if ((paf_led_pending.channels & PAF_LED_CH(ch)) &&
+            paf_led_timers[ch] == t) {
+            paf_led_isr_load_duty(ch, paf_led_pending.duty[ch],
+                                  paf_led_pending.hpoint[ch]);
+        }
+    }
+    paf_led_pending.timers &= ~(1 << t);
+}
+
+/**
+ * @brief Steps the modulators of the channels dithered on timer t, the
+ * result is the duty of the timer's next period
+ */
+static inline void IRAM_ATTR paf_led_isr_dither(int t)
+{
+    struct paf_led_dither *dither;
+    uint32_t acc;
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (!(paf_led_dither_channels & PAF_LED_CH(ch)) ||
+            paf_led_timers[ch] != t) {
+            continue;
+        }
+        dither = &paf_led_dither[ch];
+        acc = dither->acc + dither->frac;
+        dither->acc = acc & PAF_LED_DITHER_MASK;
+        paf_led_ll_set_duty(ch, dither->duty + ((acc >> PAF_LED_DITHER_BITS)
+                                                << PAF_LED_DUTY_FRAC_BITS));
+        ledc_ll_set_duty_start(&LEDC, PAF_LED_MODE, ch, true);
+    }
+}
+
+/**
+ * @brief Loads the pending commit for every timer that just overflowed and
+ * dithers the channels that need it
+ *
+ * High speed timers pick up a new divider at their next overflow, as do the
+ * channels' duty cycles. Writing both right after an overflow leaves a
+ * whole period to do so, so they land on the same period boundary as long
+ * as the period is longer than the ISR's latency, see
+ * PAF_LED_COMMIT_SYNC_MAX_RATE.
+ * Dithered timers keep their overflow interrupt, the others only have it
+ * while a commit waits for them.
+ */
+static void IRAM_ATTR paf_led_ledc_isr(void *arg)
+{
+    BaseType_t higher_prio_woken = pdFALSE;
+    unsigned char applied = 0;
+    uint32_t status;
+
+    portENTER_CRITICAL_ISR(&paf_led_pwm_lock);
+    status = LEDC.int_st.val & PAF_LED_OVF_INTS;
+    LEDC.int_clr.val = status;
+    LEDC.int_ena.val &= ~(status & ~paf_led_dither_timers);
+
+    for (int t = 0; t < LEDC_TIMER_MAX; t++) {
+        if (!(status & PAF_LED_OVF_INT(t))) {
+            continue;
+        }
+        if (paf_led_pending.timers & (1 << t)) {
+            paf_led_isr_load_timer(t);
+            applied = !paf_led_pending.timers;
+        }
+        if (paf_led_dither_timers & (1 << t)) {
+            paf_led_isr_dither(t);
+        }
+    }
+    if (applied) {
+        paf_led_applied_seq = paf_led_pending.seq;
+        applied = !paf_led_pending.quiet;
+    }
+    portEXIT_CRITICAL_ISR(&paf_led_pwm_lock);
+
+    if (applied) {
+        paf_led_isr_post(PAF_LED_EVENT_APPLIED, &higher_prio_woken);
+    }
+    if (higher_prio_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void paf_led_event_task(void *params)
+{
+    unsigned int dropped, reported = 0;
+    uint8_t event;
+
+    while (1) {
+        if (xQueueReceive(paf_led_event_queue, &event, portMAX_DELAY) !=
+            pdTRUE) {
+            continue;
+        }
+
+        switch (event) {
+            case PAF_LED_EVENT_ON:
+            case PAF_LED_EVENT_OFF:
+                // Pulse edges are only of interest on the console LED
+                if (led_mode == PAF_LED_MODE_CONSOLE) {
+                    ESP_LOGI(__func__, "Setting LED %s",
+                             event == PAF_LED_EVENT_ON ? "on" : "off");
+                }
+                else {
+                    ESP_LOGD(__func__, "LED %s",
+                             event == PAF_LED_EVENT_ON ? "on" : "off");
+                }
+                break;
+            case PAF_LED_EVENT_TEST_END:
+                ESP_LOGI(__func__, "Test duration elapsed, LED off");
+                break;
+            case PAF_LED_EVENT_APPLIED:
+                ESP_LOGD(__func__, "PWM commit %u applied",
+                         paf_led_applied_seq);
+                if (paf_led_applied_cb) {
+                    paf_led_applied_cb(paf_led_applied_seq);
+                }
+                break;
+            default:
+                break;
+        }
+
+        // Reported once the burst that overflowed the queue has drained
+        dropped = paf_led_events_dropped;
+        if (dropped != reported &&
+            !uxQueueMessagesWaiting(paf_led_event_queue)) {
+            ESP_LOGW(__func__, "%u LED events dropped", dropped - reported);
+            reported = dropped;
+        }
+    }
+}
+
+static esp_err_t paf_led_init_events(void)
+{
+    if (paf_led_event_queue) {
+        return ESP_OK;
+    }
+
+    paf_led_event_queue = xQueueCreate(PAF_LED_EVENT_QUEUE_LEN,
+                                       sizeof(uint8_t));
+    if (!paf_led_event_queue) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreatePinnedToCore(paf_led_event_task, "led_events",
+                                PAF_LED_EVENT_STACK, NULL,
+                                PAF_LED_EVENT_PRIORITY, NULL,
+                                tskNO_AFFINITY) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
 char paf_led_get_led(void)
 {
     return ledc_cfg.led_status;
 }
 
+/**
+ * @brief Mask of the channels that have a pin
+ */
+unsigned int paf_led_get_fitted(void)
+{
+    unsigned int fitted = 0;
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (paf_led_pins[ch] >= 0) {
+            fitted |= PAF_LED_CH(ch);
+        }
+    }
+
+    return fitted;
+}
+
+/**
+ * @brief Mask of the LEDC timers clocking the given channels
+ */
+static unsigned int paf_led_get_timers(unsigned int channels)
+{
+    unsigned int timers = 0;
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (channels & PAF_LED_CH(ch)) {
+            timers |= 1 << paf_led_timers[ch];
+        }
+    }
+
+    return timers;
+}
+
+/**
+ * @brief Returns the highest duty resolution, in bits, at which a timer can
+ * run at freq, 0 if freq is too high
+ *
+ * A period of 2^res counts needs a divider of at least 1, so every halving
+ * of the period costs a bit.
+ */
+static uint32_t paf_led_freq_res(unsigned int freq)
+{
+    uint32_t res = LEDC_TIMER_BIT_MAX - 1;
+
+    if (freq == 0 || freq > (APB_CLK_FREQ >> PAF_LED_PWM_MIN_RES)) {
+        return 0;
+    }
+    while (((uint64_t)freq << res) > APB_CLK_FREQ) {
+        res--;
+    }
+
+    return res;
+}
+
+/**
+ * @brief Returns the 10.8 fixed point APB clock divider for freq at
+ * resolution res, 0 if it can't be represented
+ */
+static uint32_t paf_led_freq_div(unsigned int freq, uint32_t res)
+{
+    uint64_t div;
+
+    if (freq == 0 || res == 0) {
+        return 0;
+    }
+
+    div = ((uint64_t)APB_CLK_FREQ << 8) / ((uint64_t)freq << res);
+
+    return ((div >= 256) && (div < (1 << 18))) ? div : 0;
+}
+
+static int paf_led_freq_valid(unsigned int freq)
+{
+    return paf_led_freq_div(freq, paf_led_freq_res(freq)) != 0;
+}
+
+/**
+ * @brief Returns the PWM frequency a timer runs at with the given 10.8 fixed
+ * point divider and resolution
+ */
+static inline uint32_t paf_led_timer_freq(uint32_t div, uint32_t res)
+{
+    return ((uint64_t)APB_CLK_FREQ << 8) / ((uint64_t)div << res);
+}
+
+/**
+ * @brief Converts a duty cycle in ppm to counts of a 2^res period, rounded
+ */
+static inline uint32_t paf_led_duty(uint32_t dc, uint32_t res)
+{
+    return (((uint64_t)dc << res) + PAF_LED_DC_MAX / 2) / PAF_LED_DC_MAX;
+}
+
+/**
+ * @brief Applies the closed loop trim to a duty cycle in ppm
+ */
+static uint32_t paf_led_trim_dc(uint32_t dc)
+{
+    int64_t trimmed = dc + (int64_t)dc * ledc_cfg.trim / PAF_LED_DC_MAX;
+
+    return trimmed < 0 ? 0 : trimmed > PAF_LED_DC_MAX ? PAF_LED_DC_MAX :
+           trimmed;
+}
+
+/**
+ * @brief Converts a duty cycle in ppm to 1/256 counts of a 2^res period,
+ * rounded
+ */
+static inline uint32_t paf_led_duty_fine(uint32_t dc, uint32_t res)
+{
+    return paf_led_duty(dc, res + PAF_LED_DITHER_BITS);
+}
+
+static esp_err_t paf_led_init_ledc(void)
+{
+    unsigned int fitted = paf_led_get_fitted();
+    unsigned int timers = paf_led_get_timers(fitted);
+    ledc_timer_config_t timer = ledc_timer;
+    uint32_t res = paf_led_freq_res(ledc_cfg.ledc_freq);
+    ledc_channel_config_t channel = {
+        .duty = 0,
+        .speed_mode = PAF_LED_MODE,
+        .hpoint = 0,
+    };
+    esp_err_t ret;
+
+    timer.freq_hz = ledc_cfg.ledc_freq;
+    timer.duty_resolution = res;
+    for (int t = 0; t < LEDC_TIMER_MAX; t++) {
+        ledc_cfg.timer_res[t] = res;
+        ledc_cfg.timer_div[t] = paf_led_freq_div(ledc_cfg.ledc_freq, res);
+        paf_led_timer_rate[t] = ledc_cfg.ledc_freq;
+        if (timers & (1 << t)) {
+            timer.timer_num = t;
+            if ((ret = ledc_timer_config(&timer)) != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (fitted & PAF_LED_CH(ch)) {
+            channel.channel = ch;
+            channel.gpio_num = paf_led_pins[ch];
+            channel.timer_sel = paf_led_timers[ch];
+            if ((ret = ledc_channel_config(&channel)) != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+
+    return ledc_isr_register(paf_led_ledc_isr, NULL, ESP_INTR_FLAG_IRAM,
+                             &paf_led_ledc_intr);
+}
+
 esp_err_t paf_led_init(paf_led_mode_t mode)
 {
+    unsigned int fitted = paf_led_get_fitted();
+    esp_err_t ret = ESP_OK;
+
     led_mode = mode;
+    ESP_ERROR_CHECK(paf_led_init_events());
     paf_led_init_hw_timer();
     paf_led_init_pulse();
 
+    if (!fitted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    paf_led_lock();
+    if (ledc_cfg.channels & ~fitted) {
+        ESP_LOGW(__func__, "Channels 0x%02x have no pin, using 0x%02x",
+                 ledc_cfg.channels, PAF_DEF_LED_CHANNELS & fitted);
+        ledc_cfg.channels = PAF_DEF_LED_CHANNELS & fitted;
+    }
+
     switch (mode) {
         case PAF_LED_MODE_GPIO:
-            gpio_pad_select_gpio(PAF_DEF_LED_GPIO);
-            gpio_set_direction(PAF_LED_GPIO_PIN, GPIO_MODE_OUTPUT);
+            for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+                if (fitted & PAF_LED_CH(ch)) {
+                    gpio_pad_select_gpio(paf_led_pins[ch]);
+                    gpio_set_direction(paf_led_pins[ch], GPIO_MODE_OUTPUT);
+                }
+            }
             break;
         case PAF_LED_MODE_PWM:
             if (!ledc_cfg.ledc_initd) {
-                ESP_ERROR_CHECK(ledc_timer_config(&ledc_timer));
-                ESP_ERROR_CHECK(ledc_channel_config(&ledc_channel));
-                ESP_ERROR_CHECK(ledc_fade_func_install(0));
+                for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+                    ledc_cfg.ch_dc[ch] = ledc_cfg.ledc_dc;
+                }
+                // Registers the LEDC ISR in place of the driver's fade ISR,
+                // sequencer fades are written straight to the registers
+                ESP_ERROR_CHECK(paf_led_init_ledc());
                 ledc_cfg.ledc_initd = 1;
             }
             break;
         case PAF_LED_MODE_CONSOLE:
             break;
         default:
-            return ESP_FAIL;
+            ret = ESP_FAIL;
+            break;
     }
+    paf_led_unlock();
 
-    return ESP_OK;
+    return ret;
 }
 
-enum led_pwd_update_mode {
-    FROM_CONFIG,
-    MANUAL_BOTH,
-    MANUAL_FREQ,
-    MANUAL_DC,
-};
+/**
+ * @brief Works out the group's duty cycles in counts of their timers'
+ * resolutions and spreads the rising edges of the channels that share a
+ * LEDC timer evenly over the PWM period, so they don't all switch on at once
+ *
+ * A pulse has to end within its period, so a channel is only delayed as far
+ * as its duty cycle, or the highest level of a playing sequence, allows.
+ * Fractions of a count are dithered and may lengthen a pulse by one count.
+ */
+static void paf_led_stagger(void)
+{
+    unsigned int count[LEDC_TIMER_MAX] = { 0 };
+    unsigned int slot[LEDC_TIMER_MAX] = { 0 };
+    unsigned int period, hpoint, dc, t;
+    uint32_t fine;
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (ledc_cfg.channels & PAF_LED_CH(ch)) {
+            count[paf_led_timers[ch]]++;
+        }
+    }
 
-static esp_err_t paf_led_update_freq(unsigned int freq)
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (!(ledc_cfg.channels & PAF_LED_CH(ch))) {
+            continue;
+        }
+        t = paf_led_timers[ch];
+        period = 1 << ledc_cfg.timer_res[t];
+        fine = paf_led_duty_fine(paf_led_trim_dc(ledc_cfg.ch_dc[ch]),
+                                 ledc_cfg.timer_res[t]);
+        ledc_cfg.ch_duty[ch] = (fine + (1 << (PAF_LED_DITHER_BITS -
+                                              PAF_LED_DUTY_FRAC_BITS - 1))) >>
+                               (PAF_LED_DITHER_BITS - PAF_LED_DUTY_FRAC_BITS);
+        ledc_cfg.ch_fine[ch] = fine;
+        dc = ledc_cfg.seq_max_dc ?
+             paf_led_duty(ledc_cfg.seq_max_dc, ledc_cfg.timer_res[t]) :
+             (fine + PAF_LED_DITHER_MASK) >> PAF_LED_DITHER_BITS;
+        hpoint = period * slot[t]++ / count[t];
+        if (hpoint + dc > period) {
+            hpoint = period - dc;
+        }
+        ledc_cfg.ch_hpoint[ch] = hpoint;
+    }
+}
+
+/**
+ * @brief Stages the frequency of every timer clocking the given channels, it
+ * reaches the LEDC with the next paf_led_commit()
+ */
+static esp_err_t paf_led_update_freq(unsigned int channels, unsigned int freq)
 {
-    esp_err_t err;
-    err = ledc_set_freq(ledc_timer.speed_mode, ledc_timer.timer_num,
-                        ledc_cfg.ledc_freq);
-    if (err != ESP_OK)
+    unsigned int timers = paf_led_get_timers(channels);
+    uint32_t res = paf_led_freq_res(freq);
+    uint32_t div = paf_led_freq_div(freq, res);
+
+    if (!div) {
         ESP_LOGI(__func__, "Couldn't set PWM freq\n-> %s",
-                 esp_err_to_name(err));
+                 esp_err_to_name(ESP_ERR_INVALID_ARG));
+        return ESP_ERR_INVALID_ARG;
+    }
 
-    return err;
+    for (int t = 0; t < LEDC_TIMER_MAX; t++) {
+        if (timers & (1 << t)) {
+            ledc_cfg.timer_res[t] = res;
+            ledc_cfg.timer_div[t] = div;
+            ledc_cfg.dirty_timers |= 1 << t;
+        }
+    }
+
+    return ESP_OK;
 }
 
-static esp_err_t paf_led_update_dc(unsigned int freq)
+/**
+ * @brief Hands the fractions of a count of the given group channels to the
+ * LEDC ISR, called with paf_led_pwm_lock held
+ *
+ * The ISR runs for every period of a dithered timer, so only timers up to
+ * dither_max_rate are dithered. Faster ones make do with the 1/16 counts
+ * the LEDC dithers itself.
+ */
+static void paf_led_dither_load(unsigned int channels)
 {
-    esp_err_t err;
-    err = ledc_set_duty(ledc_timer.speed_mode, ledc_timer.timer_num,
-                        ledc_cfg.ledc_dc);
-    if (err != ESP_OK)
-        ESP_LOGI(__func__, "Couldn't set PWM dc\n-> %s",
-                 esp_err_to_name(err));
+    unsigned int dither = 0;
 
-    return err;
+    if (!ledc_cfg.dither_max_rate ||
+        ledc_cfg.ledc_freq > ledc_cfg.dither_max_rate) {
+        channels = 0;
+    }
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if ((channels & PAF_LED_CH(ch)) &&
+            (ledc_cfg.ch_fine[ch] & PAF_LED_DITHER_MASK)) {
+            paf_led_dither[ch].duty = (ledc_cfg.ch_fine[ch] >>
+                                       PAF_LED_DITHER_BITS) <<
+                                      PAF_LED_DUTY_FRAC_BITS;
+            paf_led_dither[ch].frac = ledc_cfg.ch_fine[ch] &
+                                      PAF_LED_DITHER_MASK;
+            dither |= PAF_LED_CH(ch);
+        }
+    }
+    paf_led_dither_channels = dither;
+    paf_led_dither_timers = paf_led_get_timers(dither);
+    paf_led_dither_parked = 0;
+    LEDC.int_ena.val = (LEDC.int_ena.val & ~PAF_LED_OVF_INTS) |
+                       paf_led_pending.timers | paf_led_dither_timers;
 }
 
-static esp_err_t paf_led_update_pwm(enum led_pwd_update_mode mode,
-                                    unsigned int freq, unsigned int dc)
+/**
+ * @brief Hands the staged frequency and, while the LED is on, the group's
+ * duty cycles to the LEDC ISR, which loads each timer's share right after
+ * its next overflow
+ *
+ * Every period therefore runs entirely on either the old or the new
+ * parameters, no matter when the caller runs, as long as the ISR gets to
+ * the registers within a period. That only holds up to
+ * PAF_LED_COMMIT_SYNC_MAX_RATE, commits to timers running or set faster than
+ * that are written straight away and the period they land in may run on a
+ * mix of both. A later commit replaces one that has not been applied yet.
+ * Completion is reported through the hook set with
+ * paf_led_register_applied_cb(), unless the commit is quiet and has not
+ * replaced a pending one that isn't. Called with paf_led_mutex held.
+ *
+ * A playing sequence owns the duty cycles, so only frequencies are
+ * committed then.
+ */
+static void paf_led_commit_pwm(unsigned char quiet)
 {
-    switch (mode) {
-        case FROM_CONFIG:
-            paf_led_update_freq(ledc_cfg.ledc_freq);
-            paf_led_update_dc(ledc_cfg.ledc_dc);
-            ESP_ERROR_CHECK(ledc_update_duty(ledc_channel.speed_mode,
-                                             ledc_channel.channel));
-            break;
-        case MANUAL_BOTH:
-            paf_led_update_freq(freq);
-            paf_led_update_dc(dc);
-            ESP_ERROR_CHECK(ledc_update_duty(ledc_channel.speed_mode,
-                                             ledc_channel.channel));
-            break;
-        case MANUAL_FREQ:
-            paf_led_update_freq(freq);
-            paf_led_update_dc(ledc_cfg.ledc_dc);
-            ESP_ERROR_CHECK(ledc_update_duty(ledc_channel.speed_mode,
-                                             ledc_channel.channel));
-            break;
-        case MANUAL_DC:
-            paf_led_update_freq(ledc_cfg.ledc_freq);
-            paf_led_update_dc(dc);
-            ESP_ERROR_CHECK(ledc_update_duty(ledc_channel.speed_mode,
-                                             ledc_channel.channel));
-            break;
-        default:
-            return ESP_FAIL;
+    unsigned int channels = 0;
+    unsigned int timers = ledc_cfg.dirty_timers;
+    unsigned char sync = 1;
+    uint32_t rate;
+
+    if ((led_mode != PAF_LED_MODE_PWM) || (!ledc_cfg.ledc_initd)) {
+        return;
+    }
+
+    if (ledc_cfg.led_status && !ledc_cfg.seq_max_dc) {
+        paf_led_stagger();
+        channels = ledc_cfg.channels;
+        timers |= paf_led_get_timers(channels);
+    }
+    if (!timers) {
+        return;
+    }
+
+    for (int t = 0; t < LEDC_TIMER_MAX; t++) {
+        if (!(timers & (1 << t))) {
+            continue;
+        }
+        rate = paf_led_timer_freq(ledc_cfg.timer_div[t], ledc_cfg.timer_res[t]);
+        if (rate > PAF_LED_COMMIT_SYNC_MAX_RATE ||
+            paf_led_timer_rate[t] > PAF_LED_COMMIT_SYNC_MAX_RATE) {
+            sync = 0;
+        }
+        paf_led_timer_rate[t] = rate;
+    }
+
+    portENTER_CRITICAL(&paf_led_pwm_lock);
+    for (int t = 0; t < LEDC_TIMER_MAX; t++) {
+        paf_led_pending.div[t] = ledc_cfg.timer_div[t];
+        paf_led_pending.res[t] = ledc_cfg.timer_res[t];
+    }
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        paf_led_pending.duty[ch] = ledc_cfg.ch_duty[ch];
+        paf_led_pending.hpoint[ch] = ledc_cfg.ch_hpoint[ch];
+    }
+    paf_led_pending.quiet = quiet && (!paf_led_pending.timers ||
+                                      paf_led_pending.quiet);
+    quiet = paf_led_pending.quiet;
+    paf_led_pending.channels = channels;
+    paf_led_pending.timers = timers;
+    paf_led_pending.seq = ++paf_led_commit_seq;
+    if (sync) {
+        // Overflows from before the commit must not apply it early
+        LEDC.int_clr.val = timers;
+    }
+    else {
+        for (int t = 0; t < LEDC_TIMER_MAX; t++) {
+            if (timers & (1 << t)) {
+                paf_led_isr_load_timer(t);
+            }
+        }
+        paf_led_applied_seq = paf_led_pending.seq;
+    }
+    paf_led_dither_load(channels);
+    portEXIT_CRITICAL(&paf_led_pwm_lock);
+
+    if (!sync && !quiet) {
+        paf_led_post(PAF_LED_EVENT_APPLIED);
+    }
+
+    ledc_cfg.dirty_timers = 0;
+}
+
+static void paf_led_commit(void)
+{
+    paf_led_commit_pwm(0);
+}
+
+void paf_led_register_applied_cb(paf_led_applied_cb_t cb)
+{
+    paf_led_applied_cb = cb;
+}
+
+uint32_t paf_led_get_commit_seq(void)
+{
+    return paf_led_commit_seq;
+}
+
+/**
+ * @brief Returns the sequence number of the last commit in effect on all
+ * its timers, equal to paf_led_get_commit_seq() once nothing is pending
+ */
+uint32_t paf_led_get_applied(void)
+{
+    return paf_led_applied_seq;
+}
+
+/**
+ * @brief Loads the duty cycles and staggered phases of the group into the
+ * LEDC, the outputs are enabled with them
+ */
+static esp_err_t paf_led_update_dc(void)
+{
+    paf_led_stagger();
+
+    // The driver only takes whole counts
+    portENTER_CRITICAL(&paf_led_pwm_lock);
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (ledc_cfg.channels & PAF_LED_CH(ch)) {
+            paf_led_isr_load_duty(ch, ledc_cfg.ch_duty[ch],
+                                  ledc_cfg.ch_hpoint[ch]);
+        }
     }
+    paf_led_dither_load(ledc_cfg.seq_max_dc ? 0 : ledc_cfg.channels);
+    portEXIT_CRITICAL(&paf_led_pwm_lock);
 
     return ESP_OK;
 }
 
+static esp_err_t paf_led_off_channels(unsigned int channels)
+{
+    esp_err_t ret = ESP_OK;
+    esp_err_t err;
+
+    portENTER_CRITICAL(&paf_led_pwm_lock);
+    paf_led_pending.channels &= ~channels;
+    paf_led_dither_load(paf_led_dither_channels & ~channels);
+    portEXIT_CRITICAL(&paf_led_pwm_lock);
+
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (!(channels & PAF_LED_CH(ch))) {
+            continue;
+        }
+        err = ESP_OK;
+        if (led_mode == PAF_LED_MODE_PWM && ledc_cfg.ledc_initd) {
+            err = ledc_stop(PAF_LED_MODE, ch, 0);
+        }
+        else if (led_mode == PAF_LED_MODE_GPIO) {
+            err = gpio_set_level(paf_led_pins[ch], 0);
+        }
+        // The other channels are still switched off
+        if (err != ESP_OK) {
+            ESP_LOGE(__func__, "Couldn't switch channel %d off\n-> %s", ch,
+                     esp_err_to_name(err));
+            ret = err;
+        }
+    }
+
+    return ret;
+}
+
+static void paf_led_set_group_dc(unsigned int dc)
+{
+    ledc_cfg.ledc_dc = dc;
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (ledc_cfg.channels & PAF_LED_CH(ch)) {
+            ledc_cfg.ch_dc[ch] = dc;
+        }
+    }
+}
+
+static void paf_led_set_gpio_group(void)
+{
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (ledc_cfg.channels & PAF_LED_CH(ch)) {
+            ESP_ERROR_CHECK(gpio_set_level(paf_led_pins[ch], 1));
+        }
+    }
+}
+
 esp_err_t paf_led_set_on(void)
 {
     esp_err_t ret = ESP_OK;
+
+    paf_led_lock();
     switch (led_mode) {
         case PAF_LED_MODE_GPIO:
-            ESP_ERROR_CHECK(gpio_set_level(PAF_DEF_LED_GPIO, 1));
+            paf_led_set_gpio_group();
             break;
         case PAF_LED_MODE_PWM:
             if (!ledc_cfg.ledc_initd) {
                 ESP_ERROR_CHECK(paf_led_init(PAF_LED_MODE_PWM));
             }
-            ESP_ERROR_CHECK(paf_led_update_pwm(FROM_CONFIG, 0, 0));
+            ESP_ERROR_CHECK(paf_led_update_dc());
             break;
 
         case PAF_LED_MODE_CONSOLE:
@@ -209,6 +1042,7 @@ esp_err_t paf_led_set_on(void)
             break;
     }
     ledc_cfg.led_status = 1;
+    paf_led_unlock();
 
     return ret;
 }
@@ -216,15 +1050,12 @@ esp_err_t paf_led_set_on(void)
 esp_err_t paf_led_set_off(void)
 {
     esp_err_t ret = ESP_OK;
+
+    paf_led_lock();
     switch (led_mode) {
         case PAF_LED_MODE_GPIO:
-            ESP_ERROR_CHECK(gpio_set_level(PAF_DEF_LED_GPIO, 0));
-            break;
         case PAF_LED_MODE_PWM:
-            if (ledc_cfg.ledc_initd) {
-                ESP_ERROR_CHECK(paf_led_update_pwm(MANUAL_DC, 0, 0));
-                ESP_ERROR_CHECK(ledc_stop(LEDC_HIGH_SPEED_MODE, PAF_LED_CHANNEL, 0));
-            }
+            ret = paf_led_off_channels(ledc_cfg.channels);
             break;
         case PAF_LED_MODE_CONSOLE:
             ESP_LOGI(__func__, "Setting LED off");
@@ -234,11 +1065,197 @@ esp_err_t paf_led_set_off(void)
             break;
     }
     ledc_cfg.led_status = 0;
+    paf_led_unlock();
+
     return ret;
 }
 
+/**
+ * @brief Pauses a hardware timer and reloads its counter with 0, the
+ * timer_pause() and timer_set_counter_value() equivalent for ISRs
+ */
+static inline void IRAM_ATTR paf_led_isr_rewind(timg_dev_t *group,
+        timer_idx_t timer)
+{
+    group->hw_timer[timer].config.enable = 0;
+    group->hw_timer[timer].load_high = 0;
+    group->hw_timer[timer].load_low = 0;
+    group->hw_timer[timer].reload = 1;
+}
+
+#if PAF_DEF_PULSE_BACKEND == PAF_LED_PULSE_RMT
+/**
+ * @brief Fills items with level for the given number of RMT ticks, long
+ * levels are spread over several items
+ *
+ * @return Number of items used, -1 if more than max would be needed
+ */
+static int paf_led_rmt_level(rmt_item32_t *items, int max, uint32_t ticks,
+                             unsigned int level)
+{
+    int count = (ticks + 2 * PAF_LED_RMT_MAX_DURATION - 1) /
+                (2 * PAF_LED_RMT_MAX_DURATION);
+    uint32_t chunk;
+
+    // A zero duration would end the transmission
+    if (count > max || ticks == 1) {
+        return -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        chunk = ticks / (count - i);
+        ticks -= chunk;
+        items[i].level0 = level;
+        items[i].duration0 = chunk - chunk / 2;
+        items[i].level1 = level;
+        items[i].duration1 = chunk / 2;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Returns the finest RMT clock divider at which one period of the
+ * envelope fits the RMT memory
+ *
+ * The on and off levels are split over items separately, which costs at
+ * most one item more than the whole period needs. Periods up to about
+ * 50 ms run at the full 12.5 ns resolution.
+ */
+static uint32_t paf_led_rmt_div(uint32_t periode)
+{
+    uint32_t per_block = 2 * PAF_LED_RMT_MAX_DURATION *
+                         (PAF_LED_RMT_MAX_ITEMS - 1);
+
+    return periode / per_block + 1;
+}
+
+/**
+ * @brief Loads one period of the on/off envelope into the RMT, which then
+ * loops it without any CPU involvement
+ *
+ * In PWM mode the duty cycle is reproduced by the RMT carrier as the LEDC
+ * loses the pin while the RMT drives it. All channels of the group share
+ * the carrier, so they pulse at the group duty cycle without staggering.
+ */
+static esp_err_t paf_led_start_pulse(void)
+{
+    rmt_item32_t items[PAF_LED_RMT_MAX_ITEMS];
+    uint32_t div = paf_led_rmt_div(pulseGen_cfg.periode);
+    // Rounded so the period keeps its length whatever the divider
+    uint32_t on = (pulseGen_cfg.pulse_on_duraton + div / 2) / div;
+    uint32_t off = (pulseGen_cfg.periode + div / 2) / div - on;
+    uint32_t period = 0, high = 0;
+    unsigned int level = 1;
+    int on_items, off_items;
+
+    if (!pulseGen_cfg.periode || div > PAF_LED_RMT_MAX_CLK_DIV) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (led_mode == PAF_LED_MODE_PWM && ledc_cfg.ledc_dc < PAF_LED_DC_MAX) {
+        period = APB_CLK_FREQ / ledc_cfg.ledc_freq;
+        high = (uint64_t)period * ledc_cfg.ledc_dc / PAF_LED_DC_MAX;
+        if (period - high > UINT16_MAX || high > UINT16_MAX) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (!high) {
+            level = 0;
+        }
+    }
+
+    on_items = paf_led_rmt_level(items, PAF_LED_RMT_MAX_ITEMS, on, level);
+    if (on_items < 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    off_items = paf_led_rmt_level(items + on_items,
+                                  PAF_LED_RMT_MAX_ITEMS - on_items, off, 0);
+    if (off_items < 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    ESP_ERROR_CHECK(rmt_tx_stop(PAF_LED_RMT_CHANNEL));
+    ESP_ERROR_CHECK(rmt_set_clk_div(PAF_LED_RMT_CHANNEL, div));
+    // The carrier counts APB cycles, independent of the divider
+    ESP_ERROR_CHECK(rmt_set_tx_carrier(PAF_LED_RMT_CHANNEL, high != 0,
+                                       high, period - high,
+                                       RMT_CARRIER_LEVEL_HIGH));
+    // The GPIO matrix fans the one RMT output out to the whole group
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (ledc_cfg.channels & PAF_LED_CH(ch)) {
+            ESP_ERROR_CHECK(rmt_set_pin(PAF_LED_RMT_CHANNEL, RMT_MODE_TX,
+                                        paf_led_pins[ch]));
+        }
+    }
+
+    return rmt_write_items(PAF_LED_RMT_CHANNEL, items,
+                           on_items + off_items, false);
+}
+
+static void paf_led_stop_pulse(void)
+{
+    rmt_tx_stop(PAF_LED_RMT_CHANNEL);
+}
+
+static void IRAM_ATTR paf_led_isr_stop_pulse(void)
+{
+    rmt_ll_tx_stop(&RMT, PAF_LED_RMT_CHANNEL);
+}
+
+/**
+ * @brief Hands the pins back from the RMT to the LEDC or GPIO output
+ *
+ * Covers every fitted channel as the group may have changed since the RMT
+ * took over.
+ */
+static void paf_led_release_pin(void)
+{
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (paf_led_pins[ch] < 0) {
+            continue;
+        }
+        if (led_mode == PAF_LED_MODE_PWM && ledc_cfg.ledc_initd) {
+            ledc_set_pin(paf_led_pins[ch], PAF_LED_MODE, ch);
+        }
+        else if (led_mode == PAF_LED_MODE_GPIO) {
+            gpio_set_direction(paf_led_pins[ch], GPIO_MODE_OUTPUT);
+        }
+    }
+}
+#else
+static esp_err_t paf_led_start_pulse(void)
+{
+    ESP_LOGI(__func__, "Activate Timer 0 GROUP 1 for Pulse");
+    ESP_ERROR_CHECK(timer_start(TIMER_GROUP_1, TIMER_0));
+    ESP_LOGI(__func__, "Activate Timer 1 GROUP 1 for Pulse");
+    ESP_ERROR_CHECK(timer_start(TIMER_GROUP_1, TIMER_1));
+
+    return ESP_OK;
+}
+
+static void paf_led_stop_pulse(void)
+{
+    timer_pause(TIMER_GROUP_1, TIMER_0);
+    timer_pause(TIMER_GROUP_1, TIMER_1);
+    timer_set_counter_value(TIMER_GROUP_1, TIMER_0, 0);
+    timer_set_counter_value(TIMER_GROUP_1, TIMER_1, 0);
+}
+
+static void paf_led_release_pin(void)
+{
+}
+
+static void IRAM_ATTR paf_led_isr_stop_pulse(void)
+{
+    paf_led_isr_rewind(&TIMERG1, TIMER_0);
+    paf_led_isr_rewind(&TIMERG1, TIMER_1);
+}
+#endif
+
 esp_err_t paf_led_start_test(void)
 {
+    esp_err_t err;
+
     if (!ledc_cfg.ledc_initd) {
         return -1;
     }
@@ -246,10 +1263,13 @@ esp_err_t paf_led_start_test(void)
     paf_led_set_on();
 
     if (pulseGen_cfg.pulse_selected && pulseGen_cfg.pulse_inited) {
-        ESP_LOGI(__func__, "Activate Timer 0 GROUP 1 for Pulse");
-        ESP_ERROR_CHECK(timer_start(TIMER_GROUP_1, TIMER_0));
-        ESP_LOGI(__func__, "Activate Timer 1 GROUP 1 for Pulse");
-        ESP_ERROR_CHECK(timer_start(TIMER_GROUP_1, TIMER_1));
+        if ((err = paf_led_start_pulse()) != ESP_OK) {
+            ESP_LOGE(__func__, "Couldn't start pulses\n-> %s",
+                     esp_err_to_name(err));
+        }
+    }
+    else {
+        paf_led_release_pin();
     }
     ESP_LOGI(__func__, "Activate Timer for test duration");
     timer_start(TIMER_GROUP_0, TIMER_0);
@@ -258,16 +1278,173 @@ esp_err_t paf_led_start_test(void)
     return 0;
 }
 
+/**
+ * @brief Aborts a running test, the LED is switched off and the duration and
+ * pulse timers are rewound for the next test
+ */
+esp_err_t paf_led_stop_test(void)
+{
+    timer_pause(TIMER_GROUP_0, TIMER_0);
+    timer_set_counter_value(TIMER_GROUP_0, TIMER_0, 0);
+    paf_led_stop_pulse();
+    paf_led_release_pin();
+
+    return paf_led_set_off();
+}
+
+/**
+ * @brief Works out the LEDC fade that goes from one level to another, in
+ * ppm, over the given time at the current PWM frequency and resolution, or
+ * jumps to to if from equals to
+ *
+ * The hardware limits the number and length of the steps, so a ramp may
+ * end a few counts short of to, and a very slow one ends early.
+ */
+void paf_led_get_fade(unsigned int from, unsigned int to,
+                      unsigned int duration_us, struct paf_led_fade *fade)
+{
+    uint32_t res = 0;
+    uint32_t delta, scale, num;
+    uint32_t cycles = (uint64_t)duration_us * ledc_cfg.ledc_freq / 1000000;
+
+    // The group's timers all run at the group frequency
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (ledc_cfg.channels & PAF_LED_CH(ch)) {
+            res = ledc_cfg.timer_res[paf_led_timers[ch]];
+            break;
+        }
+    }
+    // A GPIO can't dim, a ramp is on or off after where it ends
+    fade->on = to != 0;
+    from = paf_led_duty(from, res);
+    to = paf_led_duty(to, res);
+    delta = from > to ? from - to : to - from;
+
+    fade->duty = to;
+    fade->num = 1;
+    fade->cycle = 1;
+    fade->scale = 0;
+    fade->inc = 1;
+
+    if (!delta || !cycles) {
+        return;
+    }
+
+    // Big enough steps to fit both the step count and the duration
+    scale = (delta + PAF_LED_FADE_MAX - 1) / PAF_LED_FADE_MAX;
+    if (scale < (delta + cycles - 1) / cycles) {
+        scale = (delta + cycles - 1) / cycles;
+    }
+    if (scale > PAF_LED_FADE_MAX) {
+        scale = PAF_LED_FADE_MAX;
+    }
+    // At 20 bits the capped steps alone overflow duty_num, spread delta over
+    // as many steps as it holds instead. Rounding down keeps the ramp short
+    // of to, the rest is the final jump
+    num = delta / scale;
+    if (num > PAF_LED_FADE_MAX) {
+        num = PAF_LED_FADE_MAX;
+        scale = delta / num;
+        if (scale > PAF_LED_FADE_MAX) {
+            scale = PAF_LED_FADE_MAX;
+        }
+    }
+
+    fade->scale = scale;
+    fade->num = num;
+    fade->cycle = cycles / num > PAF_LED_FADE_MAX ? PAF_LED_FADE_MAX :
+                  cycles / num;
+    fade->duty = from;
+    fade->inc = to > from;
+}
+
+/**
+ * @brief Loads a fade into the group's duty registers, from ISR or task
+ * context
+ */
+void IRAM_ATTR paf_led_isr_set_fade(const struct paf_led_fade *fade)
+{
+    for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+        if (!(ledc_cfg.channels & PAF_LED_CH(ch))) {
+            continue;
+        }
+        if (led_mode == PAF_LED_MODE_PWM) {
+            ledc_ll_set_duty_int_part(&LEDC, PAF_LED_MODE, ch, fade->duty);
+            ledc_ll_set_duty_direction(&LEDC, PAF_LED_MODE, ch, fade->inc);
+            ledc_ll_set_duty_num(&LEDC, PAF_LED_MODE, ch, fade->num);
+            ledc_ll_set_duty_cycle(&LEDC, PAF_LED_MODE, ch, fade->cycle);
+            ledc_ll_set_duty_scale(&LEDC, PAF_LED_MODE, ch, fade->scale);
+            ledc_ll_set_duty_start(&LEDC, PAF_LED_MODE, ch, true);
+        }
+        else if (led_mode == PAF_LED_MODE_GPIO) {
+            gpio_ll_set_level(&GPIO, paf_led_pins[ch], fade->on);
+        }
+    }
+}
+
+/**
+ * @brief Hands the group over to the sequencer
+ *
+ * The phases are staggered for the highest level of the sequence so every
+ * segment's pulse still fits its period.
+ */
+esp_err_t paf_led_start_seq(unsigned int max_dc)
+{
+    if (led_mode == PAF_LED_MODE_PWM && !ledc_cfg.ledc_initd) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (max_dc > PAF_LED_DC_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    paf_led_lock();
+    paf_led_stop_test();
+    ledc_cfg.seq_max_dc = max_dc ? max_dc : 1;
+    if (led_mode == PAF_LED_MODE_PWM) {
+        // The sequencer owns the duty cycles from here on
+        portENTER_CRITICAL(&paf_led_pwm_lock);
+        paf_led_pending.channels &= ~ledc_cfg.channels;
+        paf_led_dither_load(0);
+        portEXIT_CRITICAL(&paf_led_pwm_lock);
+        paf_led_stagger();
+        for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+            if (ledc_cfg.channels & PAF_LED_CH(ch)) {
+                ledc_set_duty_with_hpoint(PAF_LED_MODE, ch, 0,
+                                          ledc_cfg.ch_hpoint[ch]);
+                ledc_update_duty(PAF_LED_MODE, ch);
+            }
+        }
+    }
+    ledc_cfg.led_status = 1;
+    paf_led_unlock();
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Switches the group off once the sequencer has stopped and goes
+ * back to the regular phases
+ */
+void paf_led_stop_seq(void)
+{
+    paf_led_lock();
+    ledc_cfg.seq_max_dc = 0;
+    paf_led_set_off();
+    paf_led_unlock();
+}
+
 esp_err_t paf_led_set_toggle(void)
 {
+    esp_err_t ret;
+
+    paf_led_lock();
     ESP_LOGI(__func__, "Toggling LED %d -> %d", ledc_cfg.led_status,
              !ledc_cfg.led_status);
 
-    if (ledc_cfg.led_status) {
-        return paf_led_set_off();
-    }
+    ret = ledc_cfg.led_status ? paf_led_set_off() : paf_led_set_on();
+    paf_led_unlock();
 
-    return paf_led_set_on();
+    return ret;
 }
 
 esp_err_t paf_led_set_dc(unsigned int duty_cycle)
@@ -276,14 +1453,15 @@ esp_err_t paf_led_set_dc(unsigned int duty_cycle)
         return -1;
     }
 
-    if (paf_led_update_dc(duty_cycle) == ESP_OK) {
-        ledc_cfg.ledc_dc = duty_cycle;
-        if (ledc_cfg.led_status) {
-            paf_led_update_pwm(FROM_CONFIG, 0, 0);
-        }
-
+    if (duty_cycle > PAF_LED_DC_MAX) {
+        return ESP_ERR_INVALID_ARG;
     }
 
+    paf_led_lock();
+    paf_led_set_group_dc(duty_cycle);
+    paf_led_commit();
+    paf_led_unlock();
+
     ESP_LOGI(__func__, "DC set to %d", duty_cycle);
 
     return ESP_OK;
@@ -305,16 +1483,19 @@ esp_err_t paf_led_set_freq(unsigned int freq)
         return -1;
     }
 
-    if (paf_led_update_freq(freq) == ESP_OK) { //Check freq is valid
-        ledc_cfg.ledc_freq = freq;
-        if (ledc_cfg.led_status) {
-            ESP_ERROR_CHECK(paf_led_update_pwm(FROM_CONFIG, 0, 0));
-        }
+    paf_led_lock();
+    if (paf_led_update_freq(ledc_cfg.channels, freq) != ESP_OK) {
+        paf_led_unlock();
+        return ESP_ERR_INVALID_ARG;
     }
+    ledc_cfg.ledc_freq = freq;
+    paf_led_commit();
+    paf_led_unlock();
 
-    ESP_LOGI(__func__, "Freq set to %d", freq);
+    ESP_LOGI(__func__, "Freq set to %d, %u bit duty", freq,
+             paf_led_freq_res(freq));
 
-    return 0;
+    return ESP_OK;
 }
 
 unsigned int paf_led_get_freq(void)
@@ -326,6 +1507,252 @@ unsigned int paf_led_get_freq(void)
     return ledc_cfg.ledc_freq;
 }
 
+/**
+ * @brief Selects the channels switched by paf_led_set_on/off() and tests,
+ * takes effect immediately if the LED is on
+ *
+ * @param channels PAF_LED_CH() mask, channels without a pin are rejected
+ */
+esp_err_t paf_led_set_channels(unsigned int channels)
+{
+    return paf_led_set_config(PAF_LED_CFG_CH, 0, 0, 0, channels);
+}
+
+unsigned int paf_led_get_channels(void)
+{
+    return ledc_cfg.channels;
+}
+
+/**
+ * @brief Sets the duty cycle of a single channel, in or out of the group
+ */
+esp_err_t paf_led_set_channel_dc(unsigned int channel, unsigned int dc)
+{
+    if (channel >= PAF_LED_CHANNELS || dc > PAF_LED_DC_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((led_mode != PAF_LED_MODE_PWM) || (!ledc_cfg.ledc_initd)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    paf_led_lock();
+    ledc_cfg.ch_dc[channel] = dc;
+    if (ledc_cfg.channels & PAF_LED_CH(channel)) {
+        paf_led_commit();
+    }
+    paf_led_unlock();
+
+    return ESP_OK;
+}
+
+unsigned int paf_led_get_channel_dc(unsigned int channel)
+{
+    if (channel >= PAF_LED_CHANNELS) {
+        return -1;
+    }
+
+    return ledc_cfg.ch_dc[channel];
+}
+
+/**
+ * @brief Sets the highest PWM frequency at which the LEDC ISR dithers duty
+ * cycles below a count, 0 leaves it to the LEDC's own 1/16 counts
+ *
+ * The ISR runs once per period of every dithered timer, so max_rate bounds
+ * the CPU time dithering takes.
+ */
+esp_err_t paf_led_set_dither(unsigned int max_rate)
+{
+    paf_led_lock();
+    ledc_cfg.dither_max_rate = max_rate;
+    paf_led_commit();
+    paf_led_unlock();
+
+    return ESP_OK;
+}
+
+unsigned int paf_led_get_dither(void)
+{
+    return ledc_cfg.dither_max_rate;
+}
+
+/**
+ * @brief Scales the duty cycles of the group by 1 + trim / PAF_LED_DC_MAX,
+ * set by the closed loop regulation, see paf_ctrl.h
+ *
+ * The set duty cycles are left as they are, the trim is committed like
+ * them and takes effect at the next period boundary. The regulation sets it
+ * up to every loop step, so its commits don't report being applied.
+ */
+esp_err_t paf_led_set_trim(int32_t trim)
+{
+    if (trim <= -PAF_LED_DC_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((led_mode != PAF_LED_MODE_PWM) || (!ledc_cfg.ledc_initd)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    paf_led_lock();
+    if (trim != ledc_cfg.trim) {
+        ledc_cfg.trim = trim;
+        paf_led_commit_pwm(1);
+    }
+    paf_led_unlock();
+
+    return ESP_OK;
+}
+
+int32_t paf_led_get_trim(void)
+{
+    return ledc_cfg.trim;
+}
+
+
+/**
+ * @brief Applies a validated paf_led_set_config(), called with paf_led_mutex
+ * held
+ */
+static esp_err_t paf_led_apply_config(unsigned int mask, unsigned int freq,
+                                      unsigned int dc, unsigned int duration,
+                                      unsigned int channels)
+{
+    unsigned int group = (mask & PAF_LED_CFG_CH) ? channels :
+                         ledc_cfg.channels;
+    esp_err_t err;
+
+    // The new group's timers are staged first, so a frequency they can't
+    // run leaves the group as it was. Timers joining the group take on its
+    // frequency and resolution
+    if ((mask & PAF_LED_CFG_FREQ) || (group != ledc_cfg.channels &&
+                                      led_mode == PAF_LED_MODE_PWM &&
+                                      ledc_cfg.ledc_initd)) {
+        err = paf_led_update_freq(group, (mask & PAF_LED_CFG_FREQ) ? freq :
+                                  ledc_cfg.ledc_freq);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    if (group != ledc_cfg.channels) {
+        if (ledc_cfg.led_status &&
+            (err = paf_led_off_channels(ledc_cfg.channels & ~group)) !=
+            ESP_OK) {
+            return err;
+        }
+        ledc_cfg.channels = group;
+    }
+    if (mask & PAF_LED_CFG_FREQ) {
+        ledc_cfg.ledc_freq = freq;
+    }
+    if (mask & PAF_LED_CFG_DC) {
+        paf_led_set_group_dc(dc);
+    }
+    if (mask & (PAF_LED_CFG_FREQ | PAF_LED_CFG_DC | PAF_LED_CFG_CH)) {
+        // Channels joining the group are switched on by the commit, in
+        // phase with the ones already running
+        if (led_mode == PAF_LED_MODE_PWM) {
+            paf_led_commit();
+        }
+        else if (ledc_cfg.led_status) {
+            paf_led_set_on();
+        }
+    }
+    if (mask & PAF_LED_CFG_TIME) {
+        paf_led_set_time(duration);
+    }
+
+    ESP_LOGI(__func__, "Config set {freq: %u, dc: %u, dur: %u, ch: 0x%02x}",
+             ledc_cfg.ledc_freq, ledc_cfg.ledc_dc, led_onDuration_ms,
+             ledc_cfg.channels);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Validates and applies any subset of frequency, duty cycle and on
+ * duration at once
+ *
+ * Nothing is changed if any of the selected parameters is invalid. New
+ * frequency and duty cycle are handed to the LEDC in a single commit, see
+ * paf_led_commit() for when and how they take effect. Frequency and duty
+ * cycle apply to the new group if the channels are changed as well.
+ *
+ * @param mask PAF_LED_CFG_* flags selecting which parameters to apply
+ */
+esp_err_t paf_led_set_config(unsigned int mask, unsigned int freq,
+                             unsigned int dc, unsigned int duration,
+                             unsigned int channels)
+{
+    esp_err_t err;
+
+    if ((mask & PAF_LED_CFG_FREQ) && !paf_led_freq_valid(freq)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((mask & PAF_LED_CFG_DC) && dc > PAF_LED_DC_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((mask & PAF_LED_CFG_TIME) && duration == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((mask & PAF_LED_CFG_CH) &&
+        (!channels || (channels & ~paf_led_get_fitted()))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((mask & (PAF_LED_CFG_FREQ | PAF_LED_CFG_DC)) &&
+        ((led_mode != PAF_LED_MODE_PWM) || (!ledc_cfg.ledc_initd))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    paf_led_lock();
+    err = paf_led_apply_config(mask, freq, dc, duration, channels);
+    paf_led_unlock();
+
+    return err;
+}
+
+void paf_led_get_settings(struct paf_led_settings *settings)
+{
+    paf_led_lock();
+    settings->freq = ledc_cfg.ledc_freq;
+    settings->dc = ledc_cfg.ledc_dc;
+    settings->duration = led_onDuration_ms;
+    settings->channels = ledc_cfg.channels;
+    paf_led_unlock();
+}
+
+/**
+ * @brief Restores persisted settings, before or after paf_led_init()
+ */
+esp_err_t paf_led_load_settings(const struct paf_led_settings *settings)
+{
+    esp_err_t err = ESP_OK;
+
+    if (!paf_led_freq_valid(settings->freq) ||
+        settings->dc > PAF_LED_DC_MAX || !settings->duration ||
+        !settings->channels ||
+        (settings->channels & ~paf_led_get_fitted())) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    paf_led_lock();
+    if (ledc_cfg.ledc_initd) {
+        err = paf_led_set_config(PAF_LED_CFG_FREQ | PAF_LED_CFG_DC |
+                                 PAF_LED_CFG_TIME | PAF_LED_CFG_CH,
+                                 settings->freq, settings->dc,
+                                 settings->duration, settings->channels);
+    }
+    else {
+        // Picked up by paf_led_init()
+        ledc_cfg.ledc_freq = settings->freq;
+        ledc_cfg.ledc_dc = settings->dc;
+        ledc_cfg.channels = settings->channels;
+        led_onDuration_ms = settings->duration;
+    }
+    paf_led_unlock();
+
+    return err;
+}
+
 unsigned int paf_led_get_time(void)
 {
     return led_onDuration_ms;
@@ -339,76 +1766,107 @@ void paf_led_set_time(unsigned int duration)
     ESP_LOGI(__func__, "Timer set to %d ms", duration);
 }
 
-static void timer0_tg0_isr(void *arg)
+static void IRAM_ATTR timer0_tg0_isr(void *arg)
 {
+    BaseType_t higher_prio_woken = pdFALSE;
+
     timer_spinlock_take(TIMER_GROUP_0);
-    paf_led_set_off();
+    // The pulse generator goes first as it may be driving the pin
+    paf_led_isr_stop_pulse();
+    paf_led_isr_set_off(&higher_prio_woken);
 
-    timer_pause(TIMER_GROUP_0, TIMER_0);
-    timer_set_counter_value(TIMER_GROUP_0, TIMER_0, 0);
+    paf_led_isr_rewind(&TIMERG0, TIMER_0);
     timer_group_clr_intr_status_in_isr(TIMER_GROUP_0, TIMER_0);
-    timer_group_intr_clr_in_isr(TIMER_GROUP_0, TIMER_0);
     TIMERG0.hw_timer[0].config.alarm_en = true;
-
-    timer_pause(TIMER_GROUP_1, TIMER_0);
-    timer_pause(TIMER_GROUP_1, TIMER_1);
-    timer_set_counter_value(TIMER_GROUP_1, TIMER_0, 0);
-    timer_set_counter_value(TIMER_GROUP_1, TIMER_1, 0);
     timer_spinlock_give(TIMER_GROUP_0);
+
+    paf_led_isr_post(PAF_LED_EVENT_TEST_END, &higher_prio_woken);
+    if (higher_prio_woken) {
+        portYIELD_FROM_ISR();
+    }
 }
 
-static void pulseGen_pulse_timer0_tg1_isr(void *arg)
+#if PAF_DEF_PULSE_BACKEND == PAF_LED_PULSE_TIMER
+static void IRAM_ATTR pulseGen_pulse_timer0_tg1_isr(void *arg)
 {
+    BaseType_t higher_prio_woken = pdFALSE;
+
     timer_spinlock_take(TIMER_GROUP_1);
-    paf_led_set_off();
+    paf_led_isr_set_off(&higher_prio_woken);
     timer_group_clr_intr_status_in_isr(TIMER_GROUP_1, TIMER_0);
-    timer_group_intr_clr_in_isr(TIMER_GROUP_1, TIMER_0);
-    timer_pause(TIMER_GROUP_1, TIMER_0);
-    timer_set_counter_value(TIMER_GROUP_1, TIMER_0, 0);
+    paf_led_isr_rewind(&TIMERG1, TIMER_0);
     timer_spinlock_give(TIMER_GROUP_1);
 
-
+    if (higher_prio_woken) {
+        portYIELD_FROM_ISR();
+    }
 }
 
-static void pulseGen_periode_timer1_tg1_isr(void *arg)
+static void IRAM_ATTR pulseGen_periode_timer1_tg1_isr(void *arg)
 {
+    BaseType_t higher_prio_woken = pdFALSE;
+
     timer_spinlock_take(TIMER_GROUP_1);
-    paf_led_set_on();
-    timer_pause(TIMER_GROUP_1, TIMER_1);
-    timer_group_intr_clr_in_isr(TIMER_GROUP_1, TIMER_1);
+    paf_led_isr_set_on(&higher_prio_woken);
+    paf_led_isr_rewind(&TIMERG1, TIMER_1);
     timer_group_clr_intr_status_in_isr(TIMER_GROUP_1, TIMER_1);
-    timer_set_counter_value(TIMER_GROUP_1, TIMER_1, 0);
-
-
 
     // Activate Timer 0 Alarm
     TIMERG1.hw_timer[0].config.alarm_en = true;
 
     // Activate Timer 1 Alarm
     TIMERG1.hw_timer[1].config.alarm_en = true;
-    timer_start(TIMER_GROUP_1, TIMER_0);
-    timer_start(TIMER_GROUP_1, TIMER_1);
+    TIMERG1.hw_timer[0].config.enable = 1;
+    TIMERG1.hw_timer[1].config.enable = 1;
     timer_spinlock_give(TIMER_GROUP_1);
+
+    if (higher_prio_woken) {
+        portYIELD_FROM_ISR();
+    }
 }
+#endif
 
 void paf_led_init_hw_timer()
 {
     timer_init(TIMER_GROUP_0, TIMER_0, &hw_timer0_config);
     timer_set_counter_value(TIMER_GROUP_0, TIMER_0, 0);
     timer_set_alarm_value(TIMER_GROUP_0, TIMER_0, led_onDuration_ms * 10);
-    timer_isr_register(TIMER_GROUP_0, TIMER_0, &timer0_tg0_isr, NULL, 0, &s_timer_handle);
+    timer_isr_register(TIMER_GROUP_0, TIMER_0, &timer0_tg0_isr, NULL,
+                       ESP_INTR_FLAG_IRAM, &s_timer_handle);
     timer_enable_intr(TIMER_GROUP_0, TIMER_0);
 }
 
-esp_err_t paf_led_init_pulse()
+#if PAF_DEF_PULSE_BACKEND == PAF_LED_PULSE_RMT
+static esp_err_t paf_led_init_pulse_backend(void)
 {
-    pulseGen_cfg.periode  = 0;
-    pulseGen_cfg.pulse_on_duraton = 0;
-    pulseGen_cfg.pulse_inited = 1;
-    pulseGen_cfg.pulse_selected = 0;
+    rmt_config_t config = {
+        .rmt_mode = RMT_MODE_TX,
+        .channel = PAF_LED_RMT_CHANNEL,
+        .gpio_num = PAF_LED_GPIO_PIN,
+        .clk_div = PAF_LED_RMT_CLK_DIV,
+        .mem_block_num = 1,
+        .tx_config = {
+            .carrier_level = RMT_CARRIER_LEVEL_HIGH,
+            .idle_level = RMT_IDLE_LEVEL_LOW,
+            .carrier_en = false,
+            .loop_en = true,
+            .idle_output_en = true,
+        },
+    };
+    esp_err_t ret;
+
+    // Routes the pin to the RMT, paf_led_init() hands it back to the LEDC
+    if ((ret = rmt_config(&config)) != ESP_OK) {
+        return ret;
+    }
 
-    //Setting counter prescaler to 800 -> 0.01 ms resolution
-    pulseGen_cfg.hw_timer_config.divider = 800;
+    return rmt_driver_install(PAF_LED_RMT_CHANNEL, 0, 0);
+}
+#else
+static esp_err_t paf_led_init_pulse_backend(void)
+{
+    // The timers can't count the APB clock undivided, 25 ns resolution
+    pulseGen_cfg.hw_timer_config.divider = PAF_LED_PULSE_TIMER_DIV;
     pulseGen_cfg.hw_timer_config.counter_dir = TIMER_COUNT_UP;
     pulseGen_cfg.hw_timer_config.counter_en = TIMER_PAUSE;
     pulseGen_cfg.hw_timer_config.intr_type = TIMER_INTR_LEVEL;
@@ -420,19 +1878,34 @@ esp_err_t paf_led_init_pulse()
     //setup timer 0
     ret |= timer_init(TIMER_GROUP_1, TIMER_0, &pulseGen_cfg.hw_timer_config);
     ret |= timer_set_counter_value(TIMER_GROUP_1, TIMER_0, 0);
-    ret |= timer_set_alarm_value(TIMER_GROUP_1, TIMER_0, pulseGen_cfg.pulse_on_duraton);
-    ret |= timer_isr_register(TIMER_GROUP_1, TIMER_0, &pulseGen_pulse_timer0_tg1_isr, NULL, 0, &s_timer_handle);
+    ret |= timer_set_alarm_value(TIMER_GROUP_1, TIMER_0,
+                                 pulseGen_cfg.pulse_on_duraton /
+                                 PAF_LED_PULSE_TIMER_DIV);
+    ret |= timer_isr_register(TIMER_GROUP_1, TIMER_0, &pulseGen_pulse_timer0_tg1_isr, NULL, ESP_INTR_FLAG_IRAM, &s_timer_handle);
     ret |= timer_enable_intr(TIMER_GROUP_1, TIMER_0);
 
     //setup timer 1
     ret |= timer_init(TIMER_GROUP_1, TIMER_1, &pulseGen_cfg.hw_timer_config);
     ret |= timer_set_counter_value(TIMER_GROUP_1, TIMER_1, 0);
-    ret |= timer_set_alarm_value(TIMER_GROUP_1, TIMER_1, pulseGen_cfg.periode);
-    ret |= timer_isr_register(TIMER_GROUP_1, TIMER_1, &pulseGen_periode_timer1_tg1_isr, NULL, 0, &s_timer_handle);
+    ret |= timer_set_alarm_value(TIMER_GROUP_1, TIMER_1,
+                                 pulseGen_cfg.periode /
+                                 PAF_LED_PULSE_TIMER_DIV);
+    ret |= timer_isr_register(TIMER_GROUP_1, TIMER_1, &pulseGen_periode_timer1_tg1_isr, NULL, ESP_INTR_FLAG_IRAM, &s_timer_handle);
     ret |= timer_enable_intr(TIMER_GROUP_1, TIMER_1);
 
     return ret;
 }
+#endif
+
+esp_err_t paf_led_init_pulse()
+{
+    pulseGen_cfg.periode  = 0;
+    pulseGen_cfg.pulse_on_duraton = 0;
+    pulseGen_cfg.pulse_inited = 1;
+    pulseGen_cfg.pulse_selected = 0;
+
+    return paf_led_init_pulse_backend();
+}
 
 int paf_led_set_pulse_periode(unsigned int periode)
 {
@@ -442,7 +1915,10 @@ int paf_led_set_pulse_periode(unsigned int periode)
     }
 
     pulseGen_cfg.periode = periode;
-    timer_set_alarm_value(TIMER_GROUP_1, TIMER_1, periode);
+#if PAF_DEF_PULSE_BACKEND == PAF_LED_PULSE_TIMER
+    timer_set_alarm_value(TIMER_GROUP_1, TIMER_1,
+                          periode / PAF_LED_PULSE_TIMER_DIV);
+#endif
     return 0;
 }
 
@@ -453,11 +1929,39 @@ int paf_led_set_pulse_on_duration(unsigned int pulse_on_duration)
     }
 
     pulseGen_cfg.pulse_on_duraton = pulse_on_duration;
-    timer_set_alarm_value(TIMER_GROUP_1, TIMER_0, pulse_on_duration);
+#if PAF_DEF_PULSE_BACKEND == PAF_LED_PULSE_TIMER
+    timer_set_alarm_value(TIMER_GROUP_1, TIMER_0,
+                          pulse_on_duration / PAF_LED_PULSE_TIMER_DIV);
+#endif
     return 0;
 
 }
 
+/**
+ * @brief Sets period and on time of the pulse train at once, in
+ * PULS_TIMER_TICKS_S ticks
+ *
+ * Unlike setting them one after the other this can't fail on the way from
+ * one train to another.
+ */
+esp_err_t paf_led_set_pulse(uint32_t periode, uint32_t pulse_on_duration)
+{
+    if (!periode || pulse_on_duration > periode) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pulseGen_cfg.periode = periode;
+    pulseGen_cfg.pulse_on_duraton = pulse_on_duration;
+#if PAF_DEF_PULSE_BACKEND == PAF_LED_PULSE_TIMER
+    timer_set_alarm_value(TIMER_GROUP_1, TIMER_0,
+                          pulse_on_duration / PAF_LED_PULSE_TIMER_DIV);
+    timer_set_alarm_value(TIMER_GROUP_1, TIMER_1,
+                          periode / PAF_LED_PULSE_TIMER_DIV);
+#endif
+
+    return ESP_OK;
+}
+
 unsigned int paf_led_get_pulse_periode()
 {
     if (!pulseGen_cfg.pulse_inited) {
@@ -474,6 +1978,11 @@ unsigned int paf_led_get_pulse_on_duration()
     return pulseGen_cfg.pulse_on_duraton;
 }
 
+unsigned char paf_led_get_pulse_selected(void)
+{
+    return pulseGen_cfg.pulse_selected && pulseGen_cfg.pulse_inited;
+}
+
 void paf_led_set_pulse_selected()
 {
     pulseGen_cfg.pulse_selected = 1;
@@ -483,3 +1992,64 @@ void paf_led_set_pulse_not_selected()
 {
     pulseGen_cfg.pulse_selected = 0;
 }
+
+static int paf_led_cmd_channel(int argc, char **argv)
+{
+    unsigned long val, dc;
+    char *end;
+
+    if (argc == 1) {
+        printf("Group 0x%02x, fitted 0x%02x\n", ledc_cfg.channels,
+               paf_led_get_fitted());
+        for (int ch = 0; ch < PAF_LED_CHANNELS; ch++) {
+            if (paf_led_pins[ch] >= 0) {
+                printf("%d: GPIO %d, timer %d (%u bit), dc %u ppm, "
+                       "hpoint %u%s\n", ch, paf_led_pins[ch],
+                       paf_led_timers[ch],
+                       ledc_cfg.timer_res[paf_led_timers[ch]],
+                       ledc_cfg.ch_dc[ch], ledc_cfg.ch_hpoint[ch],
+                       paf_led_dither_channels & PAF_LED_CH(ch) ?
+                       ", dithered" : "");
+            }
+        }
+        printf("Dithering up to %u Hz\n", ledc_cfg.dither_max_rate);
+        return 0;
+    }
+
+    val = strtoul(argv[2 < argc ? 2 : 1], &end, 0);
+    if (argc == 3 && !strcmp(argv[1], "group") && !*end) {
+        if (paf_led_set_channels(val) != ESP_OK) {
+            printf("Invalid group 0x%02lx\n", val);
+            return 1;
+        }
+        return 0;
+    }
+    if (argc == 3 && !strcmp(argv[1], "dither") && !*end) {
+        return paf_led_set_dither(val) != ESP_OK;
+    }
+    if (argc == 4 && !strcmp(argv[1], "dc") && !*end) {
+        dc = strtoul(argv[3], &end, 0);
+        if (*end || paf_led_set_channel_dc(val, dc) != ESP_OK) {
+            printf("Couldn't set channel %lu to %s\n", val, argv[3]);
+            return 1;
+        }
+        return 0;
+    }
+
+    printf("Usage: channel [group <mask> | dc <channel> <ppm> | "
+           "dither <max_hz>]\n");
+    return 1;
+}
+
+void register_led(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "channel",
+        .help = "Show the LED channels, select the group driven by tests "
+        "and manual control, set the duty cycle of a single channel or the "
+        "highest PWM frequency dithered below a count",
+        .hint = "[group <mask> | dc <channel> <ppm> | dither <max_hz>]",
+        .func = &paf_led_cmd_channel,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
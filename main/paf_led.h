@@ -23,9 +23,66 @@
    ----------------------------------------------------------------------
 @endverbatim
  */
+#include "freertos/FreeRTOS.h"
+
 #include "esp_err.h"
 
-#define PULS_TIMER_TICKS_S 100000
+// Pulse train times are counted in APB clock cycles of 12.5 ns
+#define PULS_TIMER_TICKS_S 80000000
+// Period of a pulse train at FREQ Hz in whole ticks, rounded to the nearest
+#define PAF_LED_PULSE_TICKS(FREQ) ((PULS_TIMER_TICKS_S + (FREQ) / 2) / (FREQ))
+// Shortest period the pulse backends can generate, one tick on, one off
+#define PAF_LED_PULSE_MIN_TICKS 2
+
+// Pulse generator backends, see PAF_DEF_PULSE_BACKEND
+#define PAF_LED_PULSE_TIMER 0 /**< Legacy TG1 ISR ping-pong */
+#define PAF_LED_PULSE_RMT 1 /**< Envelope generated by the RMT in hardware */
+
+// Duty cycles are in ppm of the PWM period, whatever the LEDC resolution
+#define PAF_LED_DC_MAX 1000000
+
+// LED channels, one per LEDC high speed channel
+#define PAF_LED_CHANNELS 8
+#define PAF_LED_CH(N) (1 << (N))
+#define PAF_LED_CH_ALL ((1 << PAF_LED_CHANNELS) - 1)
+
+// Parameter selection for paf_led_set_config()
+#define PAF_LED_CFG_FREQ (1 << 0)
+#define PAF_LED_CFG_DC (1 << 1)
+#define PAF_LED_CFG_TIME (1 << 2)
+#define PAF_LED_CFG_CH (1 << 3)
+
+/**
+ * @brief Manual LED settings as persisted by paf_flash
+ */
+struct paf_led_settings {
+    unsigned int freq;
+    unsigned int dc;
+    unsigned int duration;
+    unsigned int channels;
+};
+
+/**
+ * @brief LEDC duty settings for one sequencer segment, see paf_seq.h
+ *
+ * The duty starts at duty and then moves by scale counts every cycle PWM
+ * periods, num times. A plain level has num 1 and scale 0. In GPIO mode
+ * the pin is driven at on for the whole segment.
+ */
+struct paf_led_fade {
+    uint32_t duty;
+    uint16_t num;
+    uint16_t cycle;
+    uint16_t scale;
+    uint8_t inc;
+    uint8_t on; /**< Whether the segment ends above 0 */
+};
+
+/**
+ * @brief Called from the LED event task once a commit of new PWM parameters
+ * is in effect on the hardware, with its sequence number
+ */
+typedef void (*paf_led_applied_cb_t)(uint32_t seq);
 
 typedef enum paf_led_mode {
     PAF_LED_MODE_NOTSET = 0,
@@ -36,6 +93,13 @@ typedef enum paf_led_mode {
 esp_err_t paf_led_set_start_test(void);
 esp_err_t paf_led_set_on(void);
 esp_err_t paf_led_set_off(void);
+void paf_led_isr_set_on(BaseType_t *higher_prio_woken);
+void paf_led_isr_set_off(BaseType_t *higher_prio_woken);
+void paf_led_get_fade(unsigned int from, unsigned int to,
+                      unsigned int duration_us, struct paf_led_fade *fade);
+void paf_led_isr_set_fade(const struct paf_led_fade *fade);
+esp_err_t paf_led_start_seq(unsigned int max_dc);
+void paf_led_stop_seq(void);
 esp_err_t paf_led_set_toggle(void);
 esp_err_t  paf_led_set_dc(unsigned int duty_cycle);
 unsigned int paf_led_get_dc(void);
@@ -45,12 +109,36 @@ char paf_led_get_led(void);
 esp_err_t paf_led_init(paf_led_mode_t mode);
 unsigned int paf_led_get_time(void);
 void paf_led_set_time(unsigned int duration);
+esp_err_t paf_led_set_channels(unsigned int channels);
+unsigned int paf_led_get_channels(void);
+unsigned int paf_led_get_fitted(void);
+esp_err_t paf_led_set_channel_dc(unsigned int channel, unsigned int dc);
+unsigned int paf_led_get_channel_dc(unsigned int channel);
+esp_err_t paf_led_set_dither(unsigned int max_rate);
+unsigned int paf_led_get_dither(void);
+esp_err_t paf_led_set_trim(int32_t trim);
+int32_t paf_led_get_trim(void);
+esp_err_t paf_led_set_config(unsigned int mask, unsigned int freq,
+                             unsigned int dc, unsigned int duration,
+                             unsigned int channels);
+void paf_led_register_applied_cb(paf_led_applied_cb_t cb);
+uint32_t paf_led_get_commit_seq(void);
+uint32_t paf_led_get_applied(void);
+void paf_led_get_settings(struct paf_led_settings *settings);
+esp_err_t paf_led_load_settings(const struct paf_led_settings *settings);
 void paf_led_init_hw_timer(void);
 esp_err_t paf_led_init_pulse(void);
 esp_err_t paf_led_start_test(void);
+esp_err_t paf_led_stop_test(void);
 
 int paf_led_set_pulse_on_duration(unsigned int pulse_on_duration);
+esp_err_t paf_led_set_pulse(uint32_t periode, uint32_t pulse_on_duration);
+unsigned int paf_led_get_pulse_periode();
+unsigned int paf_led_get_pulse_on_duration();
+unsigned char paf_led_get_pulse_selected(void);
 void paf_led_set_pulse_selected();
 void paf_led_set_pulse_not_selected();
+
+void register_led(void);
 int paf_led_set_pulse_periode(unsigned int periode);
 #endif // __PAF_LED_H__
@@ -0,0 +1,209 @@
+/**
+ * @file paf_pi.c
+ * @date 16 October 2026
+ * @brief Fixed point PI controller and the output regulation loop around it
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "paf_config.h"
+#include "paf_pi.h"
+
+void paf_pi_init(paf_pi_t *pi, int32_t kp, int32_t ki, int32_t out_min,
+                 int32_t out_max)
+{
+    pi->kp = kp;
+    pi->ki = ki;
+    pi->out_min = out_min;
+    pi->out_max = out_max;
+    paf_pi_reset(pi, 0);
+}
+
+/**
+ * @brief Restarts the controller from output out, the next step continues
+ * from there without a jump
+ */
+void paf_pi_reset(paf_pi_t *pi, int32_t out)
+{
+    if (out < pi->out_min) {
+        out = pi->out_min;
+    }
+    if (out > pi->out_max) {
+        out = pi->out_max;
+    }
+    pi->integral = (int64_t)out << PAF_PI_FRAC_BITS;
+}
+
+/**
+ * @brief Runs one controller step on error and returns the new output
+ */
+int32_t paf_pi_step(paf_pi_t *pi, int32_t error)
+{
+    int64_t min = (int64_t)pi->out_min << PAF_PI_FRAC_BITS;
+    int64_t max = (int64_t)pi->out_max << PAF_PI_FRAC_BITS;
+    int64_t integral = pi->integral + (int64_t)pi->ki * error;
+    int64_t out;
+
+    if (integral < min) {
+        integral = min;
+    }
+    if (integral > max) {
+        integral = max;
+    }
+
+    out = integral + (int64_t)pi->kp * error;
+    if (out > max) {
+        out = max;
+        // Integrating further would only wind up
+        if (error > 0) {
+            integral = pi->integral;
+        }
+    }
+    else if (out < min) {
+        out = min;
+        if (error < 0) {
+            integral = pi->integral;
+        }
+    }
+    pi->integral = integral;
+
+    // Rounded, a plain shift would bias the output downwards
+    return (out + (PAF_PI_ONE >> 1)) >> PAF_PI_FRAC_BITS;
+}
+
+/**
+ * @brief Returns how far measured falls short of setpoint, in ppm of
+ * setpoint and limited to +-PAF_PI_REL_ONE
+ *
+ * Relative errors keep the loop gain the same at every setpoint.
+ */
+int32_t paf_pi_rel_error(uint32_t setpoint, uint32_t measured)
+{
+    int64_t error;
+
+    if (!setpoint) {
+        return 0;
+    }
+
+    error = ((int64_t)setpoint - measured) * PAF_PI_REL_ONE / setpoint;
+    if (error > PAF_PI_REL_ONE) {
+        return PAF_PI_REL_ONE;
+    }
+    if (error < -PAF_PI_REL_ONE) {
+        return -PAF_PI_REL_ONE;
+    }
+
+    return error;
+}
+
+void paf_pi_loop_init(paf_pi_loop_t *loop, int32_t kp, int32_t ki)
+{
+    *loop = (paf_pi_loop_t) {
+        .settle = PAF_CTRL_SETTLE_STEPS,
+    };
+    paf_pi_init(&loop->pi, kp, ki, -PAF_CTRL_TRIM_MAX, PAF_CTRL_TRIM_MAX);
+}
+
+/**
+ * @brief See paf_ctrl_enable()
+ */
+void paf_pi_loop_enable(paf_pi_loop_t *loop, unsigned char enable)
+{
+    if (enable && !loop->enabled) {
+        paf_pi_reset(&loop->pi, loop->trim);
+        if (!loop->ref) {
+            loop->calibrating = 1;
+        }
+    }
+    loop->enabled = enable;
+}
+
+/**
+ * @brief See paf_ctrl_calibrate()
+ */
+void paf_pi_loop_calibrate(paf_pi_loop_t *loop)
+{
+    loop->calibrating = 1;
+    loop->cal_sum = 0;
+    loop->cal_steps = 0;
+}
+
+/**
+ * @brief Works out the output at full duty cycle and no trim from one
+ * measured at duty cycle dc and the given trim
+ */
+static uint32_t paf_pi_loop_get_ref(uint32_t measured, uint32_t dc,
+                                    int32_t trim)
+{
+    return (uint64_t)measured * PAF_PI_REL_ONE * PAF_PI_REL_ONE /
+           ((uint64_t)dc * (PAF_PI_REL_ONE + trim));
+}
+
+/**
+ * @brief Runs one loop step on the output measured at duty cycle dc and
+ * returns the trim to apply
+ *
+ * @param steady Whether the output is a steady PWM one that can be regulated
+ */
+int32_t paf_pi_loop_step(paf_pi_loop_t *loop, uint32_t measured,
+                         uint32_t dc, unsigned char steady)
+{
+    int32_t trim;
+
+    if (!steady || !dc || dc != loop->last_dc) {
+        loop->settle = PAF_CTRL_SETTLE_STEPS;
+    }
+    loop->last_dc = dc;
+
+    if (loop->settle) {
+        loop->settle--;
+        // A calibration has to see a single output throughout
+        loop->cal_sum = 0;
+        loop->cal_steps = 0;
+    }
+    else if (loop->calibrating) {
+        // Held while calibrating, a single buffer may not average whole
+        // PWM periods
+        loop->cal_sum += measured;
+        if (++loop->cal_steps == PAF_CTRL_CAL_STEPS) {
+            loop->ref = paf_pi_loop_get_ref(loop->cal_sum /
+                                            PAF_CTRL_CAL_STEPS, dc,
+                                            loop->trim);
+            loop->calibrating = 0;
+            loop->cal_sum = 0;
+            loop->cal_steps = 0;
+        }
+    }
+    loop->setpoint = (uint64_t)loop->ref * dc / PAF_PI_REL_ONE;
+    loop->active = loop->enabled && loop->ref && !loop->settle &&
+                   !loop->calibrating &&
+                   loop->setpoint >= PAF_CTRL_MIN_SETPOINT;
+    if (loop->active) {
+        trim = paf_pi_step(&loop->pi, paf_pi_rel_error(loop->setpoint,
+                           measured));
+        if (trim >= loop->trim + PAF_CTRL_TRIM_DEADBAND ||
+            trim <= loop->trim - PAF_CTRL_TRIM_DEADBAND ||
+            trim == PAF_CTRL_TRIM_MAX || trim == -PAF_CTRL_TRIM_MAX) {
+            loop->trim = trim;
+        }
+    }
+    else if (!loop->enabled) {
+        loop->trim = 0;
+        paf_pi_reset(&loop->pi, 0);
+    }
+
+    return loop->trim;
+}
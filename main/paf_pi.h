@@ -0,0 +1,80 @@
+#ifndef __PAF_PI_H__
+#define __PAF_PI_H__
+
+/**
+ * @file paf_pi.h
+ * @date 16 October 2026
+ * @brief Fixed point PI controller and the output regulation loop around it
+ *
+ * Integer only and free of IDF dependencies, so tools/pisim builds the very
+ * same code against its plant model on the host.
+ *
+ * Gains are in 1/65536 (PAF_PI_FRAC_BITS). The integral is clamped to the
+ * output range and stops integrating while the output saturates, so the
+ * controller recovers from saturation without winding up.
+ *
+ * The loop (paf_pi_loop_t) calibrates the output, settles after changes and
+ * turns the measured output into the trim of the duty cycles, see
+ * paf_ctrl.h. It holds its trim until the controller moves it by
+ * PAF_CTRL_TRIM_DEADBAND, so noise alone doesn't recommit the duty cycles
+ * every step.
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdint.h>
+
+#define PAF_PI_FRAC_BITS 16
+#define PAF_PI_ONE (1 << PAF_PI_FRAC_BITS)
+// Relative errors are given in ppm of the setpoint, duty cycles and trims in
+// ppm as well
+#define PAF_PI_REL_ONE 1000000
+
+typedef struct paf_pi {
+    int32_t kp; /**< Output per unit of error, 1/65536 */
+    int32_t ki; /**< Output per unit of error and step, 1/65536 */
+    int32_t out_min;
+    int32_t out_max;
+    int64_t integral; /**< 1/65536 */
+} paf_pi_t;
+
+typedef struct paf_pi_loop {
+    paf_pi_t pi;
+    unsigned char enabled;
+    unsigned char active; /**< Regulating rather than holding the trim */
+    unsigned char calibrating; /**< Calibration pending or running */
+    uint32_t ref; /**< Output at full duty cycle and no trim, 0 uncalibrated */
+    uint32_t setpoint;
+    int32_t trim; /**< ppm */
+    unsigned int settle; /**< Steps left until the output is regulated */
+    uint32_t last_dc;
+    uint32_t cal_sum;
+    unsigned int cal_steps;
+} paf_pi_loop_t;
+
+void paf_pi_init(paf_pi_t *pi, int32_t kp, int32_t ki, int32_t out_min,
+                 int32_t out_max);
+void paf_pi_reset(paf_pi_t *pi, int32_t out);
+int32_t paf_pi_step(paf_pi_t *pi, int32_t error);
+int32_t paf_pi_rel_error(uint32_t setpoint, uint32_t measured);
+
+void paf_pi_loop_init(paf_pi_loop_t *loop, int32_t kp, int32_t ki);
+void paf_pi_loop_enable(paf_pi_loop_t *loop, unsigned char enable);
+void paf_pi_loop_calibrate(paf_pi_loop_t *loop);
+int32_t paf_pi_loop_step(paf_pi_loop_t *loop, uint32_t measured,
+                         uint32_t dc, unsigned char steady);
+
+#endif // __PAF_PI_H__
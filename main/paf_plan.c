@@ -0,0 +1,454 @@
+/**
+ * @file paf_plan.c
+ * @date 16 October 2026
+ * @brief Incremental parser for test plans uploaded at runtime
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_console.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "paf_config.h"
+#include "paf_flash.h"
+#include "paf_led.h"
+#include "paf_plan.h"
+#include "paf_test.h"
+
+// Shortest possible CSV test, "0,0,1\n"
+#define PAF_PLAN_MIN_CSV_LINE 6
+#define PAF_PLAN_DEF_CAPACITY 16
+// Most tests allocated up front from a size hint, about 10 KB, larger plans
+// grow from there
+#define PAF_PLAN_MAX_HINT_CAPACITY 512
+
+/**
+ * @brief Allocates memory for plans, preferring PSRAM so large plans do not
+ * eat into internal RAM
+ *
+ * @param caps Set to the capabilities of the heap the memory came from
+ */
+void *paf_plan_alloc(size_t size, uint32_t *caps)
+{
+    static const uint32_t heaps[] = { MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+                                      MALLOC_CAP_8BIT
+                                    };
+    void *mem;
+
+    for (int i = 0; i < sizeof(heaps) / sizeof(heaps[0]); i++) {
+        mem = heap_caps_malloc(size, heaps[i]);
+        if (mem) {
+            *caps = heaps[i];
+            return mem;
+        }
+    }
+
+    return NULL;
+}
+
+static esp_err_t paf_plan_fail(paf_plan_parser_t *parser, const char *error)
+{
+    parser->error = error;
+    return ESP_FAIL;
+}
+
+static esp_err_t paf_plan_grow(paf_plan_parser_t *parser)
+{
+    unsigned int capacity;
+    test_config_t *tests;
+    uint32_t caps;
+
+    if (parser->capacity >= PAF_PLAN_MAX_TESTS) {
+        return paf_plan_fail(parser, "too many tests");
+    }
+
+    capacity = parser->capacity * 2;
+    if (capacity > PAF_PLAN_MAX_TESTS) {
+        capacity = PAF_PLAN_MAX_TESTS;
+    }
+    tests = paf_plan_alloc(capacity * sizeof(test_config_t), &caps);
+    if (!tests) {
+        return paf_plan_fail(parser, "out of memory");
+    }
+
+    memcpy(tests, parser->plan.tests,
+           parser->plan.num_tests * sizeof(test_config_t));
+    heap_caps_free(parser->plan.tests);
+    parser->plan.tests = tests;
+    parser->capacity = capacity;
+    parser->caps = caps;
+
+    return ESP_OK;
+}
+
+static esp_err_t paf_plan_add(paf_plan_parser_t *parser)
+{
+    test_config_t *test;
+
+    if (parser->fields[0] &&
+        PAF_LED_PULSE_TICKS(parser->fields[0]) < PAF_LED_PULSE_MIN_TICKS) {
+        return paf_plan_fail(parser, "frequency out of range");
+    }
+    if (parser->fields[1] > PAF_LED_DC_MAX) {
+        return paf_plan_fail(parser, "duty cycle out of range");
+    }
+    if (!parser->fields[2]) {
+        return paf_plan_fail(parser, "zero duration");
+    }
+    if (parser->fields[3] & ~PAF_LED_CH_ALL) {
+        return paf_plan_fail(parser, "no such channel");
+    }
+    if ((uint64_t)parser->fields[4] * parser->fields[0] >= 1000000000) {
+        return paf_plan_fail(parser, "on time not shorter than period");
+    }
+    if (parser->plan.num_tests == parser->capacity &&
+        paf_plan_grow(parser) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    test = &parser->plan.tests[parser->plan.num_tests++];
+    test->freq = parser->fields[0];
+    test->dc = parser->fields[1];
+    test->duration = parser->fields[2];
+    test->channels = parser->fields[3];
+    test->on_time = parser->fields[4];
+
+    return ESP_OK;
+}
+
+static esp_err_t paf_plan_csv_end_line(paf_plan_parser_t *parser)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (!parser->skip && (parser->field || parser->digits)) {
+        if (parser->field < PAF_PLAN_MIN_FIELDS - 1 || !parser->digits) {
+            return paf_plan_fail(parser, "missing field");
+        }
+        ret = paf_plan_add(parser);
+    }
+
+    memset(parser->fields, 0, sizeof(parser->fields));
+    parser->field = 0;
+    parser->digits = 0;
+    parser->gap = 0;
+    parser->skip = 0;
+
+    return ret;
+}
+
+static esp_err_t paf_plan_csv_char(paf_plan_parser_t *parser, char c)
+{
+    uint32_t *val = &parser->fields[parser->field];
+
+    if (c == '\n') {
+        if (paf_plan_csv_end_line(parser) != ESP_OK) {
+            return ESP_FAIL;
+        }
+        parser->line++;
+        return ESP_OK;
+    }
+    if (parser->skip) {
+        return ESP_OK;
+    }
+
+    if (c >= '0' && c <= '9') {
+        if (parser->gap) {
+            return paf_plan_fail(parser, "missing comma");
+        }
+        if (*val > (UINT32_MAX - (c - '0')) / 10) {
+            return paf_plan_fail(parser, "number too large");
+        }
+        *val = *val * 10 + (c - '0');
+        parser->digits++;
+    }
+    else if (c == ',') {
+        if (!parser->digits) {
+            return paf_plan_fail(parser, "empty field");
+        }
+        if (parser->field == PAF_PLAN_FIELDS - 1) {
+            return paf_plan_fail(parser, "too many fields");
+        }
+        parser->field++;
+        parser->digits = 0;
+        parser->gap = 0;
+    }
+    else if (c == ' ' || c == '\t' || c == '\r') {
+        parser->gap = parser->digits != 0;
+    }
+    else if (!parser->field && !parser->digits &&
+             (c == '#' || (parser->line == 1 && isalpha((unsigned char)c)))) {
+        // Comment or column header
+        parser->skip = 1;
+    }
+    else {
+        return paf_plan_fail(parser, "unexpected character");
+    }
+
+    return ESP_OK;
+}
+
+static esp_err_t paf_plan_bin_feed(paf_plan_parser_t *parser,
+                                   const uint8_t *data, size_t len)
+{
+    const uint8_t *rec = parser->record;
+    size_t n;
+
+    while (len) {
+        n = PAF_PLAN_BIN_RECORD - parser->record_len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(parser->record + parser->record_len, data, n);
+        parser->record_len += n;
+        data += n;
+        len -= n;
+
+        if (parser->record_len < PAF_PLAN_BIN_RECORD) {
+            break;
+        }
+        for (int i = 0; i < PAF_PLAN_FIELDS; i++, rec += 4) {
+            parser->fields[i] = rec[0] | rec[1] << 8 | rec[2] << 16 |
+                                (uint32_t)rec[3] << 24;
+        }
+        rec = parser->record;
+        parser->record_len = 0;
+        if (paf_plan_add(parser) != ESP_OK) {
+            return ESP_FAIL;
+        }
+        parser->line++;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Prepares a parser
+ *
+ * @param size_hint Size of the whole upload if known, used to allocate the
+ * plan in one go, or 0. If that much memory isn't available in one block the
+ * plan starts small and grows.
+ */
+esp_err_t paf_plan_parser_init(paf_plan_parser_t *parser,
+                               paf_plan_format_t format, size_t size_hint)
+{
+    unsigned int capacity = PAF_PLAN_DEF_CAPACITY;
+
+    memset(parser, 0, sizeof(*parser));
+    parser->format = format;
+    parser->line = 1;
+
+    if (size_hint) {
+        capacity = size_hint / (format == PAF_PLAN_FORMAT_CSV ?
+                                PAF_PLAN_MIN_CSV_LINE :
+                                PAF_PLAN_BIN_RECORD) + 1;
+    }
+    if (capacity > PAF_PLAN_MAX_HINT_CAPACITY) {
+        capacity = PAF_PLAN_MAX_HINT_CAPACITY;
+    }
+
+    parser->plan.tests = paf_plan_alloc(capacity * sizeof(test_config_t),
+                                        &parser->caps);
+    if (!parser->plan.tests && capacity > PAF_PLAN_DEF_CAPACITY) {
+        capacity = PAF_PLAN_DEF_CAPACITY;
+        parser->plan.tests = paf_plan_alloc(capacity * sizeof(test_config_t),
+                                            &parser->caps);
+    }
+    if (!parser->plan.tests) {
+        parser->error = "out of memory";
+        return ESP_ERR_NO_MEM;
+    }
+    parser->capacity = capacity;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Parses the next piece of the upload, pieces may be split anywhere
+ *
+ * @return ESP_FAIL once the plan is found to be invalid, see parser->error
+ * and parser->line
+ */
+esp_err_t paf_plan_parser_feed(paf_plan_parser_t *parser, const char *data,
+                               size_t len)
+{
+    if (parser->error) {
+        return ESP_FAIL;
+    }
+
+    if (parser->format == PAF_PLAN_FORMAT_BIN) {
+        return paf_plan_bin_feed(parser, (const uint8_t *)data, len);
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        if (paf_plan_csv_char(parser, data[i]) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Completes parsing once the whole upload has been fed
+ */
+esp_err_t paf_plan_parser_finish(paf_plan_parser_t *parser)
+{
+    test_config_t *tests;
+
+    if (parser->error) {
+        return ESP_FAIL;
+    }
+
+    if (parser->format == PAF_PLAN_FORMAT_CSV) {
+        // Last line without a trailing newline
+        if (paf_plan_csv_end_line(parser) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+    else if (parser->record_len) {
+        return paf_plan_fail(parser, "truncated record");
+    }
+
+    if (!parser->plan.num_tests) {
+        return paf_plan_fail(parser, "no tests");
+    }
+
+    // The capacity was estimated from the shortest possible line
+    tests = heap_caps_realloc(parser->plan.tests,
+                              parser->plan.num_tests * sizeof(test_config_t),
+                              parser->caps);
+    if (tests) {
+        parser->plan.tests = tests;
+        parser->capacity = parser->plan.num_tests;
+    }
+
+    return ESP_OK;
+}
+
+void paf_plan_parser_abort(paf_plan_parser_t *parser)
+{
+    heap_caps_free(parser->plan.tests);
+    parser->plan.tests = NULL;
+    parser->plan.num_tests = 0;
+    parser->capacity = 0;
+}
+
+/**
+ * @brief Persists a successfully finished plan and hands it over to
+ * paf_test, which takes ownership of it
+ *
+ * A plan that couldn't be saved is not run either, it would be replaced by
+ * the stored one at the next boot. Without storage it is run all the same.
+ * The parser still owns the plan on failure, see paf_plan_parser_abort().
+ */
+esp_err_t paf_plan_parser_commit(paf_plan_parser_t *parser)
+{
+    esp_err_t err;
+
+    if (parser->error || !parser->plan.num_tests) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    err = paf_flash_save_plan(&parser->plan);
+    if (err == ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(__func__, "Plan won't survive a reboot");
+    }
+    else if (err != ESP_OK) {
+        return err;
+    }
+    paf_test_set_plan(&parser->plan);
+    parser->plan.tests = NULL;
+    parser->capacity = 0;
+
+    return ESP_OK;
+}
+
+static int load_plan(int argc, char **argv)
+{
+    paf_plan_parser_t parser;
+    unsigned char line_start = 1;
+    unsigned int num_tests;
+    char line[64];
+    esp_err_t err;
+    size_t len;
+
+    if (argc > 1) {
+        if (strcmp(argv[1], "default")) {
+            printf("Unknown argument '%s'\n", argv[1]);
+            return 1;
+        }
+        err = paf_flash_save_plan(NULL);
+        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+            printf("Couldn't remove the stored plan: %s\n",
+                   esp_err_to_name(err));
+            return 1;
+        }
+        paf_test_set_plan(NULL);
+        return 0;
+    }
+
+    if (paf_plan_parser_init(&parser, PAF_PLAN_FORMAT_CSV, 0) != ESP_OK) {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    printf("Enter tests as freq,dc,duration[,channels[,on_time_ns]], end "
+           "with an empty line\n");
+    // Input is drained up to the empty line even after an error so the rest
+    // of a pasted plan is not run as commands
+    while (fgets(line, sizeof(line), stdin)) {
+        len = strlen(line);
+        if (line_start && (line[0] == '\n' || line[0] == '\r')) {
+            break;
+        }
+        line_start = len && line[len - 1] == '\n';
+        paf_plan_parser_feed(&parser, line, len);
+    }
+
+    if (paf_plan_parser_finish(&parser) != ESP_OK) {
+        printf("Line %u: %s\n", parser.line, parser.error);
+        paf_plan_parser_abort(&parser);
+        return 1;
+    }
+
+    num_tests = parser.plan.num_tests;
+    if ((err = paf_plan_parser_commit(&parser)) != ESP_OK) {
+        printf("Couldn't save plan: %s\n", esp_err_to_name(err));
+        paf_plan_parser_abort(&parser);
+        return 1;
+    }
+    printf("%u tests loaded\n", num_tests);
+
+    return 0;
+}
+
+void register_plan(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "plan",
+        .help = "Load a test plan as CSV from the console, one "
+        "freq,dc,duration[,channels[,on_time_ns]] test per line, or restore "
+        "the built-in plan with 'plan default'",
+        .hint = "[default]",
+        .func = &load_plan,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
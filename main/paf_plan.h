@@ -0,0 +1,85 @@
+#ifndef __PAF_PLAN_H__
+#define __PAF_PLAN_H__
+
+/**
+ * @file paf_plan.h
+ * @date 16 October 2026
+ * @brief Incremental parser for test plans uploaded at runtime
+ *
+ * A plan is fed to the parser in arbitrarily sized pieces as it arrives so
+ * the upload never has to be held in memory as a whole. Two formats are
+ * understood:
+ *
+ * - CSV, one "freq,dc,duration[,channels[,on_time]]" test per line with
+ *   the frequency in Hz (0 for continuous), the duty cycle in ppm of
+ *   0..PAF_LED_DC_MAX, the duration in ms, optionally the LED channels as
+ *   a decimal PAF_LED_CH() mask and the on time of every pulse in ns.
+ *   Empty lines, lines starting with '#' and a header line are ignored.
+ * - Binary, a sequence of little endian uint32_t {freq, dc, duration,
+ *   channels, on_time} records.
+ *
+ * Tests without channels, or with a mask of 0, drive PAF_DEF_LED_CHANNELS.
+ * Pulses without an on time, or with 0, are on for half the period.
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#include "paf_test.h"
+
+#define PAF_PLAN_FIELDS 5
+// The channels and on time may be left out of CSV lines
+#define PAF_PLAN_MIN_FIELDS 3
+#define PAF_PLAN_BIN_RECORD (PAF_PLAN_FIELDS * sizeof(uint32_t))
+
+typedef enum paf_plan_format {
+    PAF_PLAN_FORMAT_CSV = 0,
+    PAF_PLAN_FORMAT_BIN,
+} paf_plan_format_t;
+
+typedef struct paf_plan_parser {
+    struct tests plan;
+    unsigned int capacity;
+    uint32_t caps; /**< Heap the tests were allocated from */
+    paf_plan_format_t format;
+    unsigned int line; /**< CSV line or binary record being parsed */
+    uint32_t fields[PAF_PLAN_FIELDS];
+    unsigned char field;
+    unsigned char digits; /**< Digits in the current CSV field */
+    unsigned char gap; /**< Whitespace after the digits of a CSV field */
+    unsigned char skip; /**< Rest of the CSV line is ignored */
+    uint8_t record[PAF_PLAN_BIN_RECORD];
+    size_t record_len;
+    const char *error; /**< Why parsing stopped, NULL while successful */
+} paf_plan_parser_t;
+
+esp_err_t paf_plan_parser_init(paf_plan_parser_t *parser,
+                               paf_plan_format_t format, size_t size_hint);
+esp_err_t paf_plan_parser_feed(paf_plan_parser_t *parser, const char *data,
+                               size_t len);
+esp_err_t paf_plan_parser_finish(paf_plan_parser_t *parser);
+void paf_plan_parser_abort(paf_plan_parser_t *parser);
+esp_err_t paf_plan_parser_commit(paf_plan_parser_t *parser);
+
+void *paf_plan_alloc(size_t size, uint32_t *caps);
+
+void register_plan(void);
+
+#endif // __PAF_PLAN_H__
@@ -0,0 +1,708 @@
+/**
+ * @file paf_seq.c
+ * @date 16 October 2026
+ * @brief Segment sequencer playing light dose waveforms
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_attr.h"
+#include "esp_console.h"
+#include "esp_heap_caps.h"
+#include "esp_intr_alloc.h"
+#include "esp_log.h"
+
+#include "driver/timer.h"
+
+#include "paf_config.h"
+#include "paf_led.h"
+#include "paf_seq.h"
+#include "paf_test.h"
+
+// 1 us ticks from the 80 MHz APB clock
+#define PAF_SEQ_TIMER_DIVIDER 80
+#define PAF_SEQ_DEF_CAPACITY 16
+// Most segments allocated up front from a size hint, 12 KB, longer
+// sequences grow from there
+#define PAF_SEQ_MAX_HINT_CAPACITY 1024
+// Shortest possible CSV segment, "0,20\n"
+#define PAF_SEQ_MIN_CSV_LINE 5
+#define PAF_SEQ_CSV_FIELDS 3
+
+// Sequencer task notification bits
+#define PAF_SEQ_NOTIFY_REFILL (1 << 0)
+#define PAF_SEQ_NOTIFY_END (1 << 1)
+
+/**
+ * @brief A segment as played by the ISR, worked out by the task
+ */
+struct paf_seq_step {
+    uint32_t ticks;
+    struct paf_led_fade fade;
+};
+
+struct paf_seq_buf {
+    struct paf_seq_step steps[PAF_SEQ_BUF_SEGMENTS];
+    unsigned int count; /**< 0 once drained by the ISR */
+};
+
+// Played by the ISR, so kept in internal RAM
+static DRAM_ATTR struct paf_seq_buf paf_seq_bufs[2];
+static DRAM_ATTR unsigned int paf_seq_play_buf;
+static DRAM_ATTR unsigned int paf_seq_play_pos;
+static DRAM_ATTR unsigned char paf_seq_playing = 0;
+static DRAM_ATTR portMUX_TYPE paf_seq_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Guards the sequence and the refill position below
+static SemaphoreHandle_t paf_seq_mutex = NULL;
+static paf_seq_segment_t *paf_seq_segments = NULL;
+static unsigned int paf_seq_count = 0;
+static unsigned int paf_seq_src_pos;
+static unsigned int paf_seq_loops_left; /**< 0 loops forever */
+static unsigned char paf_seq_src_done;
+static unsigned char paf_seq_stopped; /**< Stopped by paf_seq_stop() */
+static unsigned int paf_seq_level; /**< Where the next ramp starts */
+
+static TaskHandle_t paf_seq_task = NULL;
+static intr_handle_t paf_seq_intr;
+
+static timer_config_t paf_seq_timer_config = {
+    .divider = PAF_SEQ_TIMER_DIVIDER,
+    .counter_dir = TIMER_COUNT_UP,
+    .counter_en = TIMER_PAUSE,
+    .intr_type = TIMER_INTR_LEVEL,
+    .alarm_en = TIMER_ALARM_EN,
+    // The next segment is timed from the hardware reload, so ISR latency
+    // doesn't add up over the sequence
+    .auto_reload = TIMER_AUTORELOAD_EN,
+};
+
+/**
+ * @brief Runs at the end of every segment and starts the next one
+ */
+static void IRAM_ATTR paf_seq_isr(void *arg)
+{
+    BaseType_t higher_prio_woken = pdFALSE;
+    const struct paf_seq_step *step;
+    struct paf_seq_buf *buf;
+    uint32_t notify = 0;
+
+    timer_spinlock_take(TIMER_GROUP_0);
+    timer_group_clr_intr_status_in_isr(TIMER_GROUP_0, TIMER_1);
+    portENTER_CRITICAL_ISR(&paf_seq_lock);
+
+    buf = &paf_seq_bufs[paf_seq_play_buf];
+    if (paf_seq_play_pos == buf->count) {
+        buf->count = 0;
+        paf_seq_play_buf ^= 1;
+        paf_seq_play_pos = 0;
+        buf = &paf_seq_bufs[paf_seq_play_buf];
+        notify = PAF_SEQ_NOTIFY_REFILL;
+    }
+
+    if (buf->count) {
+        step = &buf->steps[paf_seq_play_pos++];
+        paf_led_isr_set_fade(&step->fade);
+        TIMERG0.hw_timer[TIMER_1].alarm_high = 0;
+        TIMERG0.hw_timer[TIMER_1].alarm_low = step->ticks;
+        TIMERG0.hw_timer[TIMER_1].config.alarm_en = 1;
+    }
+    else {
+        // End of the sequence, or the task fell behind
+        TIMERG0.hw_timer[TIMER_1].config.enable = 0;
+        paf_seq_playing = 0;
+        paf_led_isr_set_off(&higher_prio_woken);
+        notify = PAF_SEQ_NOTIFY_END;
+    }
+
+    portEXIT_CRITICAL_ISR(&paf_seq_lock);
+    timer_spinlock_give(TIMER_GROUP_0);
+
+    if (notify) {
+        xTaskNotifyFromISR(paf_seq_task, notify, eSetBits,
+                           &higher_prio_woken);
+    }
+    if (higher_prio_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * @brief Fills a drained buffer from the sequence, called with paf_seq_mutex
+ * held
+ */
+static void paf_seq_fill(struct paf_seq_buf *buf)
+{
+    const paf_seq_segment_t *seg;
+    struct paf_seq_step *step;
+    unsigned int count = 0;
+
+    while (count < PAF_SEQ_BUF_SEGMENTS && !paf_seq_src_done) {
+        seg = &paf_seq_segments[paf_seq_src_pos];
+        step = &buf->steps[count++];
+        step->ticks = seg->duration;
+        paf_led_get_fade((seg->flags & PAF_SEQ_RAMP) ? paf_seq_level :
+                         seg->level, seg->level, seg->duration, &step->fade);
+        paf_seq_level = seg->level;
+
+        if (++paf_seq_src_pos == paf_seq_count) {
+            paf_seq_src_pos = 0;
+            if (paf_seq_loops_left && !--paf_seq_loops_left) {
+                paf_seq_src_done = 1;
+            }
+        }
+    }
+
+    // Handing the buffer over is what the ISR checks
+    portENTER_CRITICAL(&paf_seq_lock);
+    buf->count = count;
+    portEXIT_CRITICAL(&paf_seq_lock);
+}
+
+static void paf_seq_engine(void *params)
+{
+    uint32_t events;
+
+    while (1) {
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+
+        xSemaphoreTake(paf_seq_mutex, portMAX_DELAY);
+        if ((events & PAF_SEQ_NOTIFY_REFILL) && paf_seq_playing) {
+            for (int i = 0; i < 2; i++) {
+                if (!paf_seq_bufs[i].count) {
+                    paf_seq_fill(&paf_seq_bufs[i]);
+                }
+            }
+        }
+        // A sequence may have been started again since the ISR stopped, or
+        // the ISR found the buffers paf_seq_stop() emptied, which already
+        // switched the LED off
+        if ((events & PAF_SEQ_NOTIFY_END) && !paf_seq_playing &&
+            !paf_seq_stopped) {
+            if (paf_seq_src_done) {
+                ESP_LOGI(__func__, "Sequence finished");
+            }
+            else {
+                ESP_LOGW(__func__, "Sequence stopped, buffers ran dry");
+            }
+            paf_led_stop_seq();
+        }
+        xSemaphoreGive(paf_seq_mutex);
+    }
+}
+
+/**
+ * @brief Plays the loaded sequence on the LED group, any running test or
+ * sequence is stopped
+ *
+ * @param loops Number of times to play the sequence, 0 repeats it until
+ * paf_seq_stop()
+ */
+esp_err_t paf_seq_start(unsigned int loops)
+{
+    const struct paf_seq_step *step;
+    unsigned int max_level = 0;
+    esp_err_t err;
+
+    if (!paf_seq_task) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    paf_seq_stop();
+    paf_test_stop_cur_test();
+
+    xSemaphoreTake(paf_seq_mutex, portMAX_DELAY);
+    if (!paf_seq_count) {
+        xSemaphoreGive(paf_seq_mutex);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    for (unsigned int i = 0; i < paf_seq_count; i++) {
+        if (paf_seq_segments[i].level > max_level) {
+            max_level = paf_seq_segments[i].level;
+        }
+    }
+    if ((err = paf_led_start_seq(max_level)) != ESP_OK) {
+        xSemaphoreGive(paf_seq_mutex);
+        return err;
+    }
+
+    paf_seq_src_pos = 0;
+    paf_seq_loops_left = loops;
+    paf_seq_src_done = 0;
+    paf_seq_stopped = 0;
+    paf_seq_level = 0;
+    paf_seq_bufs[0].count = 0;
+    paf_seq_bufs[1].count = 0;
+    paf_seq_fill(&paf_seq_bufs[0]);
+    paf_seq_fill(&paf_seq_bufs[1]);
+
+    // The first segment starts right away, the ISR takes over at its end
+    paf_seq_play_buf = 0;
+    paf_seq_play_pos = 1;
+    paf_seq_playing = 1;
+    step = &paf_seq_bufs[0].steps[0];
+    paf_led_isr_set_fade(&step->fade);
+    timer_set_counter_value(TIMER_GROUP_0, TIMER_1, 0);
+    timer_set_alarm_value(TIMER_GROUP_0, TIMER_1, step->ticks);
+    timer_set_alarm(TIMER_GROUP_0, TIMER_1, TIMER_ALARM_EN);
+    timer_start(TIMER_GROUP_0, TIMER_1);
+    xSemaphoreGive(paf_seq_mutex);
+
+    ESP_LOGI(__func__, "Playing %u segments, %u loops", paf_seq_count, loops);
+
+    return ESP_OK;
+}
+
+void paf_seq_stop(void)
+{
+    unsigned char was_playing;
+
+    if (!paf_seq_mutex) {
+        return;
+    }
+
+    xSemaphoreTake(paf_seq_mutex, portMAX_DELAY);
+    timer_pause(TIMER_GROUP_0, TIMER_1);
+    portENTER_CRITICAL(&paf_seq_lock);
+    was_playing = paf_seq_playing;
+    paf_seq_playing = 0;
+    paf_seq_stopped = 1;
+    paf_seq_bufs[0].count = 0;
+    paf_seq_bufs[1].count = 0;
+    portEXIT_CRITICAL(&paf_seq_lock);
+    if (was_playing) {
+        paf_led_stop_seq();
+    }
+    xSemaphoreGive(paf_seq_mutex);
+}
+
+unsigned char paf_seq_is_playing(void)
+{
+    return paf_seq_playing;
+}
+
+unsigned int paf_seq_get_count(void)
+{
+    return paf_seq_count;
+}
+
+esp_err_t paf_seq_init(void)
+{
+    esp_err_t ret;
+
+    if (paf_seq_task) {
+        return ESP_OK;
+    }
+
+    paf_seq_mutex = xSemaphoreCreateMutex();
+    if (!paf_seq_mutex) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if ((ret = timer_init(TIMER_GROUP_0, TIMER_1,
+                          &paf_seq_timer_config)) != ESP_OK) {
+        return ret;
+    }
+    timer_set_counter_value(TIMER_GROUP_0, TIMER_1, 0);
+    if ((ret = timer_isr_register(TIMER_GROUP_0, TIMER_1, &paf_seq_isr, NULL,
+                                  ESP_INTR_FLAG_IRAM,
+                                  &paf_seq_intr)) != ESP_OK) {
+        return ret;
+    }
+    timer_enable_intr(TIMER_GROUP_0, TIMER_1);
+
+    if (xTaskCreatePinnedToCore(paf_seq_engine, "sequencer",
+                                PAF_SEQ_TASK_STACK, NULL,
+                                PAF_SEQ_TASK_PRIORITY, &paf_seq_task,
+                                tskNO_AFFINITY) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+static esp_err_t paf_seq_fail(paf_seq_loader_t *loader, const char *error)
+{
+    loader->error = error;
+    return ESP_FAIL;
+}
+
+static esp_err_t paf_seq_grow(paf_seq_loader_t *loader)
+{
+    paf_seq_segment_t *segments;
+    unsigned int capacity;
+    uint32_t caps;
+
+    if (loader->capacity >= PAF_SEQ_MAX_SEGMENTS) {
+        return paf_seq_fail(loader, "too many segments");
+    }
+
+    capacity = loader->capacity * 2;
+    if (capacity > PAF_SEQ_MAX_SEGMENTS) {
+        capacity = PAF_SEQ_MAX_SEGMENTS;
+    }
+    segments = paf_plan_alloc(capacity * sizeof(paf_seq_segment_t), &caps);
+    if (!segments) {
+        return paf_seq_fail(loader, "out of memory");
+    }
+
+    memcpy(segments, loader->segments,
+           loader->count * sizeof(paf_seq_segment_t));
+    heap_caps_free(loader->segments);
+    loader->segments = segments;
+    loader->capacity = capacity;
+    loader->caps = caps;
+
+    return ESP_OK;
+}
+
+static esp_err_t paf_seq_add(paf_seq_loader_t *loader, uint32_t duration,
+                             uint32_t level, uint32_t flags)
+{
+    paf_seq_segment_t *seg;
+
+    if (level > PAF_LED_DC_MAX) {
+        return paf_seq_fail(loader, "level out of range");
+    }
+    if (duration < PAF_SEQ_MIN_SEGMENT_US) {
+        return paf_seq_fail(loader, "segment too short");
+    }
+    if (flags & ~PAF_SEQ_RAMP) {
+        return paf_seq_fail(loader, "unknown flags");
+    }
+    if (loader->count == loader->capacity &&
+        paf_seq_grow(loader) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    seg = &loader->segments[loader->count++];
+    seg->duration = duration;
+    seg->level = level;
+    seg->flags = flags;
+
+    return ESP_OK;
+}
+
+static esp_err_t paf_seq_csv_line(paf_seq_loader_t *loader)
+{
+    uint32_t vals[PAF_SEQ_CSV_FIELDS] = { 0 };
+    char *p = loader->buf, *end;
+    int n = 0;
+
+    loader->buf[loader->len] = '\0';
+    loader->len = 0;
+
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    // Empty line, comment or column header
+    if (!*p || *p == '#' || (loader->line == 1 && isalpha((unsigned char)*p))) {
+        return ESP_OK;
+    }
+
+    while (1) {
+        while (*p == ' ' || *p == '\t') {
+            p++;
+        }
+        if (!isdigit((unsigned char)*p)) {
+            return paf_seq_fail(loader, "expected a number");
+        }
+        vals[n++] = strtoul(p, &end, 10);
+        p = end;
+        while (*p == ' ' || *p == '\t' || *p == '\r') {
+            p++;
+        }
+        if (*p != ',') {
+            break;
+        }
+        if (n == PAF_SEQ_CSV_FIELDS) {
+            return paf_seq_fail(loader, "too many fields");
+        }
+        p++;
+    }
+
+    if (*p) {
+        return paf_seq_fail(loader, "unexpected character");
+    }
+    if (n < 2) {
+        return paf_seq_fail(loader, "missing field");
+    }
+
+    return paf_seq_add(loader, vals[1], vals[0],
+                       vals[2] ? PAF_SEQ_RAMP : 0);
+}
+
+/**
+ * @brief Prepares a loader
+ *
+ * @param size_hint Size of the whole upload if known, used to allocate the
+ * sequence in one go, or 0. If that much memory isn't available in one
+ * block the sequence starts small and grows.
+ */
+esp_err_t paf_seq_loader_init(paf_seq_loader_t *loader,
+                              paf_plan_format_t format, size_t size_hint)
+{
+    unsigned int capacity = PAF_SEQ_DEF_CAPACITY;
+
+    memset(loader, 0, sizeof(*loader));
+    loader->format = format;
+    loader->line = 1;
+
+    if (size_hint) {
+        capacity = size_hint / (format == PAF_PLAN_FORMAT_CSV ?
+                                PAF_SEQ_MIN_CSV_LINE :
+                                PAF_SEQ_BIN_RECORD) + 1;
+    }
+    if (capacity > PAF_SEQ_MAX_HINT_CAPACITY) {
+        capacity = PAF_SEQ_MAX_HINT_CAPACITY;
+    }
+
+    loader->segments = paf_plan_alloc(capacity * sizeof(paf_seq_segment_t),
+                                      &loader->caps);
+    if (!loader->segments && capacity > PAF_SEQ_DEF_CAPACITY) {
+        capacity = PAF_SEQ_DEF_CAPACITY;
+        loader->segments = paf_plan_alloc(capacity *
+                                          sizeof(paf_seq_segment_t),
+                                          &loader->caps);
+    }
+    if (!loader->segments) {
+        loader->error = "out of memory";
+        return ESP_ERR_NO_MEM;
+    }
+    loader->capacity = capacity;
+
+    return ESP_OK;
+}
+
+static uint32_t paf_seq_le32(const uint8_t *rec)
+{
+    return rec[0] | rec[1] << 8 | rec[2] << 16 | (uint32_t)rec[3] << 24;
+}
+
+/**
+ * @brief Parses the next piece of the upload, pieces may be split anywhere
+ *
+ * @return ESP_FAIL once the sequence is found to be invalid, see
+ * loader->error and loader->line
+ */
+esp_err_t paf_seq_loader_feed(paf_seq_loader_t *loader, const char *data,
+                              size_t len)
+{
+    const uint8_t *rec = (const uint8_t *)loader->buf;
+
+    if (loader->error) {
+        return ESP_FAIL;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        if (loader->format == PAF_PLAN_FORMAT_BIN) {
+            loader->buf[loader->len++] = data[i];
+            if (loader->len < PAF_SEQ_BIN_RECORD) {
+                continue;
+            }
+            loader->len = 0;
+            if (paf_seq_add(loader, paf_seq_le32(rec), paf_seq_le32(rec + 4),
+                            paf_seq_le32(rec + 8)) != ESP_OK) {
+                return ESP_FAIL;
+            }
+            loader->line++;
+        }
+        else if (data[i] == '\n') {
+            if (paf_seq_csv_line(loader) != ESP_OK) {
+                return ESP_FAIL;
+            }
+            loader->line++;
+        }
+        else if (loader->len == PAF_SEQ_LINE_LEN - 1) {
+            return paf_seq_fail(loader, "line too long");
+        }
+        else {
+            loader->buf[loader->len++] = data[i];
+        }
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Completes loading once the whole upload has been fed
+ */
+esp_err_t paf_seq_loader_finish(paf_seq_loader_t *loader)
+{
+    paf_seq_segment_t *segments;
+
+    if (loader->error) {
+        return ESP_FAIL;
+    }
+
+    if (loader->format == PAF_PLAN_FORMAT_CSV) {
+        // Last line without a trailing newline
+        if (loader->len && paf_seq_csv_line(loader) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+    else if (loader->len) {
+        return paf_seq_fail(loader, "truncated record");
+    }
+
+    if (!loader->count) {
+        return paf_seq_fail(loader, "no segments");
+    }
+
+    segments = heap_caps_realloc(loader->segments,
+                                 loader->count * sizeof(paf_seq_segment_t),
+                                 loader->caps);
+    if (segments) {
+        loader->segments = segments;
+        loader->capacity = loader->count;
+    }
+
+    return ESP_OK;
+}
+
+void paf_seq_loader_abort(paf_seq_loader_t *loader)
+{
+    heap_caps_free(loader->segments);
+    loader->segments = NULL;
+    loader->count = 0;
+    loader->capacity = 0;
+}
+
+/**
+ * @brief Replaces the sequence with a successfully finished one, a playing
+ * sequence is stopped first
+ */
+esp_err_t paf_seq_loader_commit(paf_seq_loader_t *loader)
+{
+    paf_seq_segment_t *old;
+
+    if (loader->error || !loader->count) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!paf_seq_mutex) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    paf_seq_stop();
+
+    xSemaphoreTake(paf_seq_mutex, portMAX_DELAY);
+    old = paf_seq_segments;
+    paf_seq_segments = loader->segments;
+    paf_seq_count = loader->count;
+    xSemaphoreGive(paf_seq_mutex);
+
+    heap_caps_free(old);
+    loader->segments = NULL;
+    loader->capacity = 0;
+
+    return ESP_OK;
+}
+
+static int load_seq(void)
+{
+    paf_seq_loader_t loader;
+    unsigned char line_start = 1;
+    char line[64];
+    size_t len;
+
+    if (paf_seq_loader_init(&loader, PAF_PLAN_FORMAT_CSV, 0) != ESP_OK) {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    printf("Enter segments as level,duration_us[,ramp], end with an empty "
+           "line\n");
+    // Input is drained up to the empty line even after an error so the rest
+    // of a pasted sequence is not run as commands
+    while (fgets(line, sizeof(line), stdin)) {
+        len = strlen(line);
+        if (line_start && (line[0] == '\n' || line[0] == '\r')) {
+            break;
+        }
+        line_start = len && line[len - 1] == '\n';
+        paf_seq_loader_feed(&loader, line, len);
+    }
+
+    if (paf_seq_loader_finish(&loader) != ESP_OK) {
+        printf("Line %u: %s\n", loader.line, loader.error);
+        paf_seq_loader_abort(&loader);
+        return 1;
+    }
+
+    printf("%u segments loaded\n", loader.count);
+    if (paf_seq_loader_commit(&loader) != ESP_OK) {
+        paf_seq_loader_abort(&loader);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int seq_cmd(int argc, char **argv)
+{
+    unsigned long loops = 1;
+    esp_err_t err;
+    char *end;
+
+    if (argc == 1) {
+        return load_seq();
+    }
+
+    if (!strcmp(argv[1], "stop")) {
+        paf_seq_stop();
+        return 0;
+    }
+
+    if (!strcmp(argv[1], "run")) {
+        if (argc > 2) {
+            loops = strtoul(argv[2], &end, 10);
+            if (*end) {
+                printf("Invalid loop count '%s'\n", argv[2]);
+                return 1;
+            }
+        }
+        if ((err = paf_seq_start(loops)) != ESP_OK) {
+            printf("Couldn't start sequence\n-> %s\n", esp_err_to_name(err));
+            return 1;
+        }
+        return 0;
+    }
+
+    printf("Unknown argument '%s'\n", argv[1]);
+    return 1;
+}
+
+void register_seq(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "seq",
+        .help = "Load a segment sequence as CSV from the console, play it "
+        "a number of times (0 repeats it) or stop it",
+        .hint = "[run [loops] | stop]",
+        .func = &seq_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
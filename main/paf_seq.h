@@ -0,0 +1,89 @@
+#ifndef __PAF_SEQ_H__
+#define __PAF_SEQ_H__
+
+/**
+ * @file paf_seq.h
+ * @date 16 October 2026
+ * @brief Segment sequencer playing light dose waveforms
+ *
+ * A sequence is a table of segments, each holding the LED group at a level,
+ * or ramping to it from the previous segment's level, for a number of
+ * microseconds. Segment boundaries are timed by TG0 timer 1 and the levels
+ * and ramps are produced by the LEDC duty and fade hardware, so the timing
+ * does not depend on the scheduler.
+ *
+ * Levels take effect at the start of the next PWM period.
+ *
+ * The sequence itself may live in PSRAM. It is streamed through two small
+ * buffers in internal RAM that the timer ISR plays in turn while a task
+ * refills the one just drained.
+ *
+ * Sequences are loaded like test plans (see paf_plan.h), either as CSV with
+ * one "level,duration[,ramp]" segment per line, the level in ppm of
+ * 0..PAF_LED_DC_MAX, the duration in us and ramp 1 to ramp up or down to the
+ * level, or as little endian {uint32_t duration, uint32_t level, uint32_t
+ * flags} records.
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#include "paf_plan.h"
+
+#define PAF_SEQ_RAMP (1 << 0)
+
+typedef struct paf_seq_segment {
+    uint32_t duration; /**< us */
+    uint32_t level; /**< Duty cycle, ppm */
+    uint32_t flags; /**< PAF_SEQ_* */
+} paf_seq_segment_t;
+
+#define PAF_SEQ_BIN_RECORD sizeof(paf_seq_segment_t)
+#define PAF_SEQ_LINE_LEN 48
+
+typedef struct paf_seq_loader {
+    paf_seq_segment_t *segments;
+    unsigned int count;
+    unsigned int capacity;
+    uint32_t caps; /**< Heap the segments were allocated from */
+    paf_plan_format_t format;
+    unsigned int line; /**< CSV line or binary record being parsed */
+    char buf[PAF_SEQ_LINE_LEN]; /**< Partial CSV line or binary record */
+    size_t len;
+    const char *error; /**< Why loading stopped, NULL while successful */
+} paf_seq_loader_t;
+
+esp_err_t paf_seq_loader_init(paf_seq_loader_t *loader,
+                              paf_plan_format_t format, size_t size_hint);
+esp_err_t paf_seq_loader_feed(paf_seq_loader_t *loader, const char *data,
+                              size_t len);
+esp_err_t paf_seq_loader_finish(paf_seq_loader_t *loader);
+void paf_seq_loader_abort(paf_seq_loader_t *loader);
+esp_err_t paf_seq_loader_commit(paf_seq_loader_t *loader);
+
+esp_err_t paf_seq_init(void);
+esp_err_t paf_seq_start(unsigned int loops);
+void paf_seq_stop(void);
+unsigned char paf_seq_is_playing(void);
+unsigned int paf_seq_get_count(void);
+
+void register_seq(void);
+
+#endif // __PAF_SEQ_H__
@@ -22,40 +22,182 @@
  */
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "paf_flash.h"
 #include "paf_led.h"
+#include "paf_seq.h"
+#include "paf_test.h"
 #include "paf_config.h"
 
-#define MIN_COUNTER_TICKS_IN_PERIOD  10
-
-typedef struct test_config {
-    unsigned int freq;
-    unsigned int dc;
-    unsigned int duration;
-} test_config_t;
+// Engine task notification bits
+#define PAF_TEST_NOTIFY_END (1 << 0)
+#define PAF_TEST_NOTIFY_TICK (1 << 1)
 
 PAF_DEF_TESTS;
 
-struct tests {
-    unsigned int num_tests;
-    unsigned int cur_test;
-    test_config_t *tests;
-} paf_test = { .num_tests = PAF_TEST_COUNT, .tests = paf_def_tests };
+struct tests paf_test = { .num_tests = PAF_TEST_COUNT,
+                          .tests = paf_def_tests };
+
+// Plan handed to paf_test_set_plan() while a test was running, it replaces
+// paf_test once that test is over
+static struct tests pending_plan;
+static unsigned char plan_pending = 0;
 
 static unsigned char auto_skip = 1;
-static int64_t cur_time_remaining = 0;
-static TaskHandle_t cur_test_task = NULL;
+static unsigned char test_running = 0;
+static unsigned char test_paused = 0;
+// Deadline of the running test on the esp_timer clock, in us
+static int64_t test_end_us;
+// Time left when the test was paused, in us
+static int64_t test_paused_left_us;
+static TaskHandle_t paf_test_task = NULL;
+static esp_timer_handle_t paf_test_end_timer = NULL;
+static esp_timer_handle_t paf_test_tick_timer = NULL;
+static portMUX_TYPE paf_test_lock = portMUX_INITIALIZER_UNLOCKED;
+// Serialises starting, stopping, pausing and ending tests, which arm and
+// disarm the timers and drive the LED, between the console, the web server
+// and the engine task. Recursive, a failed start stops the test.
+static SemaphoreHandle_t paf_test_mutex = NULL;
+static StaticSemaphore_t paf_test_mutex_buf;
+static paf_test_event_cb_t paf_test_event_cb = NULL;
+
+/**
+ * @brief Takes paf_test_mutex, created on first use as a test may be
+ * stopped before paf_test_init()
+ */
+static void paf_test_mutex_lock(void)
+{
+    if (!paf_test_mutex) {
+        portENTER_CRITICAL(&paf_test_lock);
+        if (!paf_test_mutex) {
+            paf_test_mutex =
+                xSemaphoreCreateRecursiveMutexStatic(&paf_test_mutex_buf);
+        }
+        portEXIT_CRITICAL(&paf_test_lock);
+    }
+    xSemaphoreTakeRecursive(paf_test_mutex, portMAX_DELAY);
+}
+
+static void paf_test_mutex_unlock(void)
+{
+    xSemaphoreGiveRecursive(paf_test_mutex);
+}
+
+void paf_test_register_event_cb(paf_test_event_cb_t cb)
+{
+    paf_test_event_cb = cb;
+}
+
+static void paf_test_publish(paf_test_event_t event)
+{
+    // The current test is persisted so a sweep resumes where it left off
+    if (event == PAF_TEST_EVENT_ADVANCE) {
+        paf_flash_save_settings();
+    }
+    if (paf_test_event_cb) {
+        paf_test_event_cb(event);
+    }
+}
+
+/**
+ * @brief Replaces the active plan with the pending one, must be called with
+ * paf_test_lock held
+ *
+ * @return The replaced plan's tests, to be freed by the caller once the lock
+ * has been released, or NULL
+ */
+static test_config_t *paf_test_swap_plan(void)
+{
+    test_config_t *old;
+
+    if (!plan_pending) {
+        return NULL;
+    }
+
+    old = paf_test.tests;
+    paf_test.tests = pending_plan.tests;
+    paf_test.num_tests = pending_plan.num_tests;
+    paf_test.cur_test = 0;
+    plan_pending = 0;
+
+    return old;
+}
+
+static void paf_test_free_plan(test_config_t *tests)
+{
+    if (tests && tests != paf_def_tests) {
+        heap_caps_free(tests);
+    }
+}
+
+/**
+ * @brief Installs a new test plan, taking ownership of plan->tests
+ *
+ * The plan is swapped in straight away if no test is running, otherwise
+ * once the running test has finished so a test never changes under the LED.
+ * Passing NULL restores the built-in PAF_DEF_TESTS.
+ */
+void paf_test_set_plan(struct tests *plan)
+{
+    test_config_t *stale, *old = NULL;
+    unsigned char applied;
+
+    portENTER_CRITICAL(&paf_test_lock);
+    // A plan that never became active is replaced outright
+    stale = plan_pending ? pending_plan.tests : NULL;
+    if (plan) {
+        pending_plan.tests = plan->tests;
+        pending_plan.num_tests = plan->num_tests;
+    }
+    else {
+        pending_plan.tests = paf_def_tests;
+        pending_plan.num_tests = PAF_TEST_COUNT;
+    }
+    plan_pending = 1;
+    applied = !test_running;
+    if (applied) {
+        old = paf_test_swap_plan();
+    }
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    paf_test_free_plan(stale);
+    paf_test_free_plan(old);
+    ESP_LOGI(__func__, "%s plan of %u tests", applied ? "Loaded" : "Queued",
+             plan ? plan->num_tests : PAF_TEST_COUNT);
+    if (applied) {
+        paf_test_publish(PAF_TEST_EVENT_ADVANCE);
+    }
+}
 
 void paf_test_set_auto_skip(void)
 {
     auto_skip = 1;
+    paf_flash_save_settings();
 }
 
 void paf_test_unset_auto_skip(void)
 {
     auto_skip = 0;
+    paf_flash_save_settings();
+}
+
+/**
+ * @brief Restores persisted settings, after the persisted plan has been
+ * set
+ */
+void paf_test_load_settings(unsigned int cur_test, unsigned char auto_skip_en)
+{
+    portENTER_CRITICAL(&paf_test_lock);
+    if (cur_test < paf_test.num_tests) {
+        paf_test.cur_test = cur_test;
+    }
+    auto_skip = auto_skip_en;
+    portEXIT_CRITICAL(&paf_test_lock);
 }
 
 unsigned int paf_test_get_test_count_total(void)
@@ -68,119 +210,393 @@ unsigned int paf_test_get_cur_test(void)
     return paf_test.cur_test;
 }
 
+/**
+ * @brief Time left in the current test in ms, rounded up so a running test
+ * never reads 0. Must be called with paf_test_lock held.
+ */
+static unsigned int paf_test_time_left(void)
+{
+    int64_t left;
+
+    if (!test_running) {
+        return 0;
+    }
+
+    left = test_paused ? test_paused_left_us :
+           test_end_us - esp_timer_get_time();
+    if (left <= 0) {
+        return 0;
+    }
+
+    return (left + 999) / 1000;
+}
+
 unsigned int paf_test_get_time_remaining(void)
 {
-    return cur_time_remaining;
+    unsigned int left;
+
+    portENTER_CRITICAL(&paf_test_lock);
+    left = paf_test_time_left();
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    return left;
+}
+
+void paf_test_get_status(struct paf_test_status *status)
+{
+    portENTER_CRITICAL(&paf_test_lock);
+    status->cur_test = paf_test.cur_test;
+    status->num_tests = paf_test.num_tests;
+    status->time_remaining = paf_test_time_left();
+    status->freq = paf_test.tests[paf_test.cur_test].freq;
+    status->dc = paf_test.tests[paf_test.cur_test].dc;
+    status->duration = paf_test.tests[paf_test.cur_test].duration;
+    status->channels = paf_test.tests[paf_test.cur_test].channels;
+    status->running = test_running;
+    status->auto_skip = auto_skip;
+    portEXIT_CRITICAL(&paf_test_lock);
+}
+
+static void paf_test_stop_timers(void)
+{
+    esp_timer_stop(paf_test_end_timer);
+    esp_timer_stop(paf_test_tick_timer);
 }
 
 void paf_test_stop_cur_test(void)
 {
-    if (cur_test_task) {
-        vTaskDelete(cur_test_task);
+    test_config_t *old;
+    unsigned char was_running;
+
+    paf_test_mutex_lock();
+    paf_test_stop_timers();
+
+    portENTER_CRITICAL(&paf_test_lock);
+    was_running = test_running;
+    test_running = 0;
+    test_paused = 0;
+    old = paf_test_swap_plan();
+    portEXIT_CRITICAL(&paf_test_lock);
+    paf_test_free_plan(old);
+
+    if (was_running) {
+        paf_led_stop_test();
+    }
+    if (old) {
+        paf_test_publish(PAF_TEST_EVENT_ADVANCE);
+    }
+    paf_test_publish(PAF_TEST_EVENT_STOP);
+    paf_test_mutex_unlock();
+}
+
+/**
+ * @brief Starts the timers of a test that was just marked running, a test
+ * they can't be armed for is stopped. Must be called with paf_test_mutex
+ * held.
+ */
+static esp_err_t paf_test_start_timers(uint64_t left_us)
+{
+    esp_err_t err;
+
+    err = esp_timer_start_once(paf_test_end_timer, left_us);
+    if (err == ESP_OK) {
+        err = esp_timer_start_periodic(paf_test_tick_timer,
+                                       PAF_TEST_TELEMETRY_PERIOD_MS * 1000);
     }
-    cur_test_task = NULL;
+    if (err != ESP_OK) {
+        ESP_LOGE(__func__, "Test timers not started\n-> %s",
+                 esp_err_to_name(err));
+        paf_test_stop_cur_test();
+    }
+
+    return err;
 }
 
+/**
+ * @brief Completes the running test once its deadline has passed
+ */
+static void paf_test_end(void)
+{
+    test_config_t *old = NULL;
+    unsigned char ended = 0, advanced = 0;
 
-static void wait_for_test(void *params)
+    paf_test_mutex_lock();
+    portENTER_CRITICAL(&paf_test_lock);
+    // The notification is stale if the test was stopped, paused or
+    // restarted after the end timer fired
+    if (test_running && !test_paused &&
+        esp_timer_get_time() >= test_end_us) {
+        ended = 1;
+        test_running = 0;
+        if (auto_skip) {
+            paf_test.cur_test++;
+            paf_test.cur_test %= paf_test.num_tests;
+            advanced = 1;
+        }
+        old = paf_test_swap_plan();
+    }
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    if (!ended) {
+        paf_test_mutex_unlock();
+        return;
+    }
+
+    esp_timer_stop(paf_test_tick_timer);
+    // The LED was already switched off by the duration timer, this hands the
+    // pin back after a pulse test
+    paf_led_stop_test();
+    paf_test_free_plan(old);
+    if (advanced || old) {
+        paf_test_publish(PAF_TEST_EVENT_ADVANCE);
+    }
+    paf_test_publish(PAF_TEST_EVENT_STOP);
+    paf_test_mutex_unlock();
+}
+
+/**
+ * @brief The test engine, all timing comes from esp_timer deadlines which
+ * only notify this task
+ */
+static void paf_test_engine(void *params)
 {
+    uint32_t events;
+    unsigned char running;
+
     while (1) {
-        vTaskDelay(pdMS_TO_TICKS(100));
-        cur_time_remaining -= 100;
-        if (cur_time_remaining <= 0) {
-            if (auto_skip) {
-                paf_test.cur_test++;
-                paf_test.cur_test %= paf_test.num_tests;
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+
+        if (events & PAF_TEST_NOTIFY_END) {
+            paf_test_end();
+        }
+        if (events & PAF_TEST_NOTIFY_TICK) {
+            portENTER_CRITICAL(&paf_test_lock);
+            running = test_running && !test_paused;
+            portEXIT_CRITICAL(&paf_test_lock);
+            if (running) {
+                paf_test_publish(PAF_TEST_EVENT_TICK);
             }
-            cur_time_remaining = 0;
-            paf_test_stop_cur_test();
         }
     }
 }
 
+static void paf_test_timer_cb(void *arg)
+{
+    xTaskNotify(paf_test_task, (uint32_t)(uintptr_t)arg, eSetBits);
+}
+
+esp_err_t paf_test_init(void)
+{
+    const esp_timer_create_args_t end_args = {
+        .callback = &paf_test_timer_cb,
+        .arg = (void *)PAF_TEST_NOTIFY_END,
+        .name = "test_end",
+    };
+    const esp_timer_create_args_t tick_args = {
+        .callback = &paf_test_timer_cb,
+        .arg = (void *)PAF_TEST_NOTIFY_TICK,
+        .name = "test_tick",
+    };
+    esp_err_t err;
+
+    if (paf_test_task) {
+        return ESP_OK;
+    }
+
+    if ((err = esp_timer_create(&end_args, &paf_test_end_timer)) != ESP_OK) {
+        return err;
+    }
+    if ((err = esp_timer_create(&tick_args, &paf_test_tick_timer)) !=
+        ESP_OK) {
+        return err;
+    }
+    if (xTaskCreatePinnedToCore(paf_test_engine, "test",
+                                PAF_TEST_TASK_STACK, NULL,
+                                PAF_TEST_TASK_PRIORITY, &paf_test_task,
+                                tskNO_AFFINITY) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
 void paf_test_next_test(void)
 {
+    portENTER_CRITICAL(&paf_test_lock);
     paf_test.cur_test++;
     paf_test.cur_test %= paf_test.num_tests;
+    portEXIT_CRITICAL(&paf_test_lock);
+    paf_test_publish(PAF_TEST_EVENT_ADVANCE);
 }
 
 void paf_test_prev_test(void)
 {
+    portENTER_CRITICAL(&paf_test_lock);
     if (paf_test.cur_test) {
         paf_test.cur_test--;
     }
+    portEXIT_CRITICAL(&paf_test_lock);
+    paf_test_publish(PAF_TEST_EVENT_ADVANCE);
 }
 
 void paf_test_pause_cur_test(void)
 {
-    if (cur_test_task) {
-        vTaskSuspend(cur_test_task);
+    unsigned char paused = 0;
+
+    paf_test_mutex_lock();
+    portENTER_CRITICAL(&paf_test_lock);
+    if (test_running && !test_paused) {
+        test_paused_left_us = test_end_us - esp_timer_get_time();
+        if (test_paused_left_us < 0) {
+            test_paused_left_us = 0;
+        }
+        test_paused = paused = 1;
     }
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    if (paused) {
+        paf_test_stop_timers();
+    }
+    paf_test_mutex_unlock();
 }
 
 void paf_test_resume_cur_test(void)
 {
-    if (cur_test_task) {
-        vTaskResume(cur_test_task);
+    unsigned char resumed = 0;
+    int64_t left = 0;
+
+    paf_test_mutex_lock();
+    portENTER_CRITICAL(&paf_test_lock);
+    if (test_running && test_paused) {
+        left = test_paused_left_us;
+        test_end_us = esp_timer_get_time() + left;
+        test_paused = 0;
+        resumed = 1;
     }
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    if (resumed) {
+        paf_test_start_timers(left);
+    }
+    paf_test_mutex_unlock();
 }
 
 unsigned int paf_test_get_cur_freq(void)
 {
-    return paf_test.tests[paf_test.cur_test].freq;
+    unsigned int freq;
+
+    portENTER_CRITICAL(&paf_test_lock);
+    freq = paf_test.tests[paf_test.cur_test].freq;
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    return freq;
 }
 
 unsigned int paf_test_get_cur_dc(void)
 {
-    return paf_test.tests[paf_test.cur_test].dc;
+    unsigned int dc;
+
+    portENTER_CRITICAL(&paf_test_lock);
+    dc = paf_test.tests[paf_test.cur_test].dc;
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    return dc;
 }
 
 unsigned int paf_test_get_cur_dur(void)
 {
-    return paf_test.tests[paf_test.cur_test].duration;
+    unsigned int duration;
+
+    portENTER_CRITICAL(&paf_test_lock);
+    duration = paf_test.tests[paf_test.cur_test].duration;
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    return duration;
 }
 
+/**
+ * @brief Starts a test, must be called with paf_test_mutex held so that
+ * another start can't arm the timers in between
+ */
 static esp_err_t paf_test_run_test(test_config_t *test)
 {
-    cur_time_remaining = test->duration;
+    esp_err_t err;
+
+    if (!paf_test_task) {
+        return ESP_ERR_INVALID_STATE;
+    }
 
+    // Restarting while a test runs replaces it, as does starting one while
+    // a sequence plays
+    paf_test_stop_timers();
+    paf_seq_stop();
 
+    if (paf_led_set_channels(test->channels ? test->channels :
+                             PAF_DEF_LED_CHANNELS) != ESP_OK) {
+        ESP_LOGW(__func__, "Channels 0x%02x not fitted, keeping 0x%02x",
+                 test->channels, paf_led_get_channels());
+    }
     paf_led_set_dc(test->dc);
     //set test duration in ms
     paf_led_set_time(test->duration);
     paf_led_set_pulse_not_selected();
     ESP_LOGI(__func__, "led on time set");
     if (test->freq != 0) {
-        if (test->freq > PULS_TIMER_TICKS_S / MIN_COUNTER_TICKS_IN_PERIOD) {
-            test->freq = PULS_TIMER_TICKS_S / MIN_COUNTER_TICKS_IN_PERIOD;
-        }
-
-        uint32_t ticks = PULS_TIMER_TICKS_S / test->freq;
-        ESP_LOGI(__func__, "TICKS: %d", ticks);
-        ESP_ERROR_CHECK(paf_led_set_pulse_periode(ticks));
-        ESP_ERROR_CHECK(paf_led_set_pulse_on_duration(ticks / 2));
+        uint32_t ticks = PAF_LED_PULSE_TICKS(test->freq);
+        uint32_t on = test->on_time ?
+                      (uint64_t)test->on_time * (PULS_TIMER_TICKS_S / 1000000) /
+                      1000 : ticks / 2;
 
+        ESP_LOGI(__func__, "TICKS: %u, on %u", ticks, on);
+        // A pulse test is never run as steady light instead
+        if (paf_led_set_pulse(ticks, on) != ESP_OK) {
+            ESP_LOGW(__func__, "Can't pulse at %u Hz, on for %u ns",
+                     test->freq, test->on_time);
+            paf_test_stop_cur_test();
+            return ESP_ERR_INVALID_ARG;
+        }
         paf_led_set_pulse_selected();
     }
     ESP_LOGI(__func__, "Starting Test");
     paf_led_start_test();
 
-    ESP_LOGI(__func__, "Creating test task");
-    if (xTaskCreatePinnedToCore(wait_for_test, "test", 2048, NULL,
-                                PAF_TEST_TASK_PRIORITY, &cur_test_task,
-                                tskNO_AFFINITY) != pdPASS) {
-        return ESP_FAIL;
+    // The deadline is taken right after the LED was started so the reported
+    // remaining time matches the duration timer in paf_led
+    portENTER_CRITICAL(&paf_test_lock);
+    test_end_us = esp_timer_get_time() + (int64_t)test->duration * 1000;
+    test_running = 1;
+    test_paused = 0;
+    portEXIT_CRITICAL(&paf_test_lock);
+
+    if ((err = paf_test_start_timers((uint64_t)test->duration * 1000)) !=
+        ESP_OK) {
+        return err;
     }
 
-    ESP_LOGI(__func__, "Created");
+    paf_test_publish(PAF_TEST_EVENT_START);
     return ESP_OK;
 }
 
 esp_err_t paf_test_run_next_test(void)
 {
-    test_config_t *cur_test = &paf_test.tests[paf_test.cur_test];
-    ESP_LOGI(__func__, "Running test #%d {freq: %d, dc: %d, dur: %d}",
-             paf_test.cur_test, cur_test->freq, cur_test->dc,
-             cur_test->duration);
-    return paf_test_run_test(cur_test);
+    test_config_t cur_test, *old;
+    unsigned int cur;
+    esp_err_t err;
+
+    paf_test_mutex_lock();
+    // The test is copied as the plan may be swapped while it runs
+    portENTER_CRITICAL(&paf_test_lock);
+    old = paf_test_swap_plan();
+    cur = paf_test.cur_test;
+    cur_test = paf_test.tests[cur];
+    portEXIT_CRITICAL(&paf_test_lock);
+    paf_test_free_plan(old);
+
+    ESP_LOGI(__func__, "Running test #%d {freq: %d, dc: %d, dur: %d, "
+             "ch: 0x%02x}", cur, cur_test.freq, cur_test.dc,
+             cur_test.duration, cur_test.channels);
+    err = paf_test_run_test(&cur_test);
+    paf_test_mutex_unlock();
+
+    return err;
 }
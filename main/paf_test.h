@@ -26,6 +26,57 @@
 
 #include "esp_err.h"
 
+typedef struct test_config {
+    unsigned int freq;
+    unsigned int dc;
+    unsigned int duration;
+    unsigned int channels; /**< PAF_LED_CH() mask, 0 for the default group */
+    unsigned int on_time; /**< ns per pulse, 0 for half the period */
+} test_config_t;
+
+/**
+ * @brief A test plan, the built-in PAF_DEF_TESTS or one loaded at runtime
+ * through paf_plan
+ */
+struct tests {
+    unsigned int num_tests;
+    unsigned int cur_test;
+    test_config_t *tests;
+};
+
+/**
+ * @brief State changes published to the registered event callback
+ */
+typedef enum paf_test_event {
+    PAF_TEST_EVENT_START = 0,
+    PAF_TEST_EVENT_STOP,
+    PAF_TEST_EVENT_ADVANCE, /**< Current test index changed */
+    PAF_TEST_EVENT_TICK, /**< Every PAF_TEST_TELEMETRY_PERIOD_MS while running */
+} paf_test_event_t;
+
+/**
+ * @brief Called from the context that caused the event (test task, httpd
+ * task, ...), must not block
+ */
+typedef void (*paf_test_event_cb_t)(paf_test_event_t event);
+
+/**
+ * @brief Consistent snapshot of the test engine state, see
+ * paf_test_get_status()
+ */
+struct paf_test_status {
+    unsigned int cur_test;
+    unsigned int num_tests;
+    unsigned int time_remaining;
+    unsigned int freq;
+    unsigned int dc;
+    unsigned int duration;
+    unsigned int channels;
+    unsigned char running;
+    unsigned char auto_skip;
+};
+
+esp_err_t paf_test_init(void);
 unsigned int paf_test_get_test_count_total(void);
 unsigned int paf_test_get_cur_test(void);
 unsigned int paf_test_get_time_remaining(void);
@@ -40,5 +91,9 @@ void paf_test_unset_auto_skip(void);
 unsigned int paf_test_get_cur_freq(void);
 unsigned int paf_test_get_cur_dc(void);
 unsigned int paf_test_get_cur_dur(void);
+void paf_test_get_status(struct paf_test_status *status);
+void paf_test_register_event_cb(paf_test_event_cb_t cb);
+void paf_test_set_plan(struct tests *plan);
+void paf_test_load_settings(unsigned int cur_test, unsigned char auto_skip);
 
 #endif // __PAF_TEST_H__
@@ -0,0 +1,444 @@
+/**
+ * @file paf_timing.c
+ * @date 16 October 2026
+ * @brief LED edge timestamping and jitter histograms
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_attr.h"
+#include "esp_console.h"
+#include "esp_intr_alloc.h"
+#include "esp_log.h"
+#include "esp32/clk.h"
+
+#include "driver/gpio.h"
+#include "hal/cpu_hal.h"
+#include "hal/gpio_ll.h"
+
+#include "paf_config.h"
+#include "paf_led.h"
+#include "paf_timing.h"
+
+#define PAF_TIMING_RING_MASK (PAF_TIMING_RING_LEN - 1)
+
+// The RMT makes its pulse edges in hardware, only a capture input sees them
+#define PAF_TIMING_ENABLED (PAF_TIMING_CAPTURE_GPIO >= 0 || \
+                            PAF_DEF_PULSE_BACKEND != PAF_LED_PULSE_RMT)
+
+_Static_assert((PAF_TIMING_RING_LEN & PAF_TIMING_RING_MASK) == 0,
+               "PAF_TIMING_RING_LEN must be a power of two");
+
+struct paf_timing_edge {
+    uint32_t ccount;
+    uint8_t level;
+    uint8_t core; /**< Cycle counters of the two cores are not in sync */
+};
+
+/**
+ * @brief Pulse train being measured, times in cycles
+ */
+struct paf_timing_train {
+    uint32_t period; /**< Expected, 0 while no pulse train is configured */
+    uint32_t on; /**< Expected */
+    uint32_t rise; /**< Last rising edge */
+    uint32_t next; /**< Where the next rising edge is due */
+    uint8_t core;
+    uint8_t level;
+    unsigned char started;
+};
+
+const char *const paf_timing_hist_names[PAF_TIMING_HISTS] = {
+    [PAF_TIMING_PERIOD] = "period",
+    [PAF_TIMING_ON] = "on",
+    [PAF_TIMING_PHASE] = "phase",
+};
+
+// Filled by the ISRs, so kept in internal RAM
+static DRAM_ATTR struct paf_timing_edge paf_timing_ring[PAF_TIMING_RING_LEN];
+static DRAM_ATTR volatile unsigned int paf_timing_head = 0;
+static DRAM_ATTR volatile unsigned int paf_timing_tail = 0;
+static DRAM_ATTR volatile uint32_t paf_timing_dropped = 0;
+static DRAM_ATTR unsigned char paf_timing_initd = 0;
+static DRAM_ATTR portMUX_TYPE paf_timing_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Guards the report
+static SemaphoreHandle_t paf_timing_mutex = NULL;
+static paf_timing_report_t paf_timing_report;
+static struct paf_timing_train paf_timing_train;
+static uint32_t paf_timing_seen_dropped = 0;
+static uint32_t paf_timing_cpu_mhz;
+
+static void IRAM_ATTR paf_timing_isr_record(unsigned int level,
+                                            uint32_t ccount)
+{
+    unsigned int head;
+
+    portENTER_CRITICAL_ISR(&paf_timing_lock);
+    head = paf_timing_head;
+    if (head - paf_timing_tail > PAF_TIMING_RING_MASK) {
+        paf_timing_dropped++;
+    }
+    else {
+        paf_timing_ring[head & PAF_TIMING_RING_MASK].ccount = ccount;
+        paf_timing_ring[head & PAF_TIMING_RING_MASK].level = level;
+        paf_timing_ring[head & PAF_TIMING_RING_MASK].core = xPortGetCoreID();
+        paf_timing_head = head + 1;
+    }
+    portEXIT_CRITICAL_ISR(&paf_timing_lock);
+}
+
+/**
+ * @brief Timestamps an edge made by the LED ISRs, ignored when the edges
+ * are captured from the output itself
+ */
+void IRAM_ATTR paf_timing_isr_led_edge(unsigned int level)
+{
+    if (PAF_TIMING_CAPTURE_GPIO < 0 && paf_timing_initd) {
+        paf_timing_isr_record(level, cpu_hal_get_cycle_count());
+    }
+}
+
+#if PAF_TIMING_CAPTURE_GPIO >= 0
+static void IRAM_ATTR paf_timing_capture_isr(void *arg)
+{
+    // Timestamp first, everything after it only adds latency
+    uint32_t ccount = cpu_hal_get_cycle_count();
+
+    paf_timing_isr_record(gpio_ll_get_level(&GPIO, PAF_TIMING_CAPTURE_GPIO),
+                          ccount);
+}
+
+static esp_err_t paf_timing_init_capture(void)
+{
+    gpio_config_t conf = {
+        .pin_bit_mask = 1ULL << PAF_TIMING_CAPTURE_GPIO,
+        .mode = GPIO_MODE_INPUT,
+        .intr_type = GPIO_INTR_ANYEDGE,
+    };
+    esp_err_t ret;
+
+    if ((ret = gpio_config(&conf)) != ESP_OK) {
+        return ret;
+    }
+    ret = gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        return ret;
+    }
+
+    return gpio_isr_handler_add(PAF_TIMING_CAPTURE_GPIO,
+                                paf_timing_capture_isr, NULL);
+}
+#else
+static esp_err_t paf_timing_init_capture(void)
+{
+    return ESP_OK;
+}
+#endif
+
+static void paf_timing_hist_add(paf_timing_hist_t *hist, int32_t err_ns)
+{
+    int32_t bin = err_ns / PAF_TIMING_BIN_NS + PAF_TIMING_BINS / 2;
+
+    // Round towards minus infinity so 0 starts a bin
+    if (err_ns < 0 && err_ns % PAF_TIMING_BIN_NS) {
+        bin--;
+    }
+    if (bin < 0) {
+        bin = 0;
+    }
+    else if (bin >= PAF_TIMING_BINS) {
+        bin = PAF_TIMING_BINS - 1;
+    }
+
+    hist->bins[bin]++;
+    if (!hist->count || err_ns < hist->min) {
+        hist->min = err_ns;
+    }
+    if (!hist->count || err_ns > hist->max) {
+        hist->max = err_ns;
+    }
+    hist->count++;
+    hist->sum += err_ns;
+    hist->sum_sq += (int64_t)err_ns * err_ns;
+}
+
+static void paf_timing_add(paf_timing_hist_id_t id, int32_t err_cycles)
+{
+    paf_timing_hist_add(&paf_timing_report.hists[id],
+                        (int64_t)err_cycles * 1000 / paf_timing_cpu_mhz);
+}
+
+/**
+ * @brief Picks up the configured pulse train, the train is restarted if it
+ * changed
+ */
+static void paf_timing_update_train(struct paf_timing_train *train)
+{
+    uint64_t period = paf_led_get_pulse_periode();
+    uint64_t on = paf_led_get_pulse_on_duration();
+
+    // Pulse ticks to CPU cycles
+    period = period * paf_timing_cpu_mhz / (PULS_TIMER_TICKS_S / 1000000);
+    on = on * paf_timing_cpu_mhz / (PULS_TIMER_TICKS_S / 1000000);
+    if (!paf_led_get_pulse_selected() || !period ||
+        paf_led_get_pulse_periode() == (unsigned int) -1 ||
+        period > UINT32_MAX / 2) {
+        period = on = 0;
+    }
+
+    if (train->period != period || train->on != on) {
+        train->period = period;
+        train->on = on;
+        train->started = 0;
+        paf_timing_report.period_ns = (uint64_t)train->period * 1000 /
+                                      paf_timing_cpu_mhz;
+        paf_timing_report.on_ns = (uint64_t)train->on * 1000 /
+                                  paf_timing_cpu_mhz;
+    }
+}
+
+static void paf_timing_process(struct paf_timing_train *train,
+                               const struct paf_timing_edge *edge)
+{
+    int32_t err;
+    uint32_t skipped;
+
+    paf_timing_report.edges++;
+
+    if (!train->period) {
+        return;
+    }
+    if (train->started && train->core != edge->core) {
+        train->started = 0;
+    }
+
+    if (edge->level && !train->level) {
+        if (train->started &&
+            edge->ccount - train->rise < 2 * train->period) {
+            paf_timing_add(PAF_TIMING_PERIOD,
+                           edge->ccount - train->rise - train->period);
+
+            // Edges missed in between move the schedule along
+            err = edge->ccount - train->next;
+            if (err > (int32_t)(train->period / 2)) {
+                skipped = (err + train->period / 2) / train->period;
+                train->next += skipped * train->period;
+                err -= skipped * train->period;
+            }
+            paf_timing_add(PAF_TIMING_PHASE, err);
+        }
+        else {
+            // First edge of a train, or the first after a pause
+            train->started = 1;
+            train->core = edge->core;
+            train->next = edge->ccount;
+        }
+        train->rise = edge->ccount;
+        train->next += train->period;
+    }
+    else if (!edge->level && train->level && train->started &&
+             edge->ccount - train->rise < train->period) {
+        paf_timing_add(PAF_TIMING_ON,
+                       edge->ccount - train->rise - train->on);
+    }
+    train->level = edge->level;
+}
+
+static void paf_timing_task(void *params)
+{
+    struct paf_timing_edge edge;
+    uint32_t dropped;
+
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(PAF_TIMING_POLL_MS));
+
+        xSemaphoreTake(paf_timing_mutex, portMAX_DELAY);
+        paf_timing_update_train(&paf_timing_train);
+
+        while (paf_timing_tail != paf_timing_head) {
+            edge = paf_timing_ring[paf_timing_tail & PAF_TIMING_RING_MASK];
+            portENTER_CRITICAL(&paf_timing_lock);
+            paf_timing_tail++;
+            portEXIT_CRITICAL(&paf_timing_lock);
+            paf_timing_process(&paf_timing_train, &edge);
+        }
+
+        // Pairs across lost edges would be bogus
+        dropped = paf_timing_dropped;
+        if (dropped != paf_timing_seen_dropped) {
+            paf_timing_report.dropped += dropped - paf_timing_seen_dropped;
+            paf_timing_seen_dropped = dropped;
+            paf_timing_train.started = 0;
+        }
+        xSemaphoreGive(paf_timing_mutex);
+    }
+}
+
+esp_err_t paf_timing_init(void)
+{
+    esp_err_t ret;
+
+    if (paf_timing_initd) {
+        return ESP_OK;
+    }
+    if (!PAF_TIMING_ENABLED) {
+        ESP_LOGW(__func__, "RMT pulse edges need PAF_TIMING_CAPTURE_GPIO, "
+                 "timing disabled");
+        return ESP_OK;
+    }
+
+    paf_timing_mutex = xSemaphoreCreateMutex();
+    if (!paf_timing_mutex) {
+        return ESP_ERR_NO_MEM;
+    }
+    paf_timing_cpu_mhz = esp_clk_cpu_freq() / 1000000;
+
+    if ((ret = paf_timing_init_capture()) != ESP_OK) {
+        return ret;
+    }
+
+    if (xTaskCreatePinnedToCore(paf_timing_task, "timing",
+                                PAF_TIMING_TASK_STACK, NULL,
+                                PAF_TIMING_TASK_PRIORITY, NULL,
+                                tskNO_AFFINITY) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    paf_timing_report.enabled = 1;
+    paf_timing_initd = 1;
+
+    return ESP_OK;
+}
+
+void paf_timing_reset(void)
+{
+    if (!paf_timing_initd) {
+        return;
+    }
+
+    xSemaphoreTake(paf_timing_mutex, portMAX_DELAY);
+    memset(paf_timing_report.hists, 0, sizeof(paf_timing_report.hists));
+    paf_timing_report.edges = 0;
+    paf_timing_report.dropped = 0;
+    xSemaphoreGive(paf_timing_mutex);
+}
+
+void paf_timing_get_report(paf_timing_report_t *report)
+{
+    if (!paf_timing_initd) {
+        memset(report, 0, sizeof(*report));
+        return;
+    }
+
+    xSemaphoreTake(paf_timing_mutex, portMAX_DELAY);
+    *report = paf_timing_report;
+    xSemaphoreGive(paf_timing_mutex);
+}
+
+/**
+ * @brief Lower edge of a histogram bin, in ns
+ */
+int32_t paf_timing_bin_ns(unsigned int bin)
+{
+    return ((int32_t)bin - PAF_TIMING_BINS / 2) * PAF_TIMING_BIN_NS;
+}
+
+int32_t paf_timing_hist_mean(const paf_timing_hist_t *hist)
+{
+    return hist->count ? hist->sum / (int64_t)hist->count : 0;
+}
+
+uint32_t paf_timing_hist_stddev(const paf_timing_hist_t *hist)
+{
+    double mean, var;
+
+    if (hist->count < 2) {
+        return 0;
+    }
+
+    mean = (double)hist->sum / hist->count;
+    var = (double)hist->sum_sq / hist->count - mean * mean;
+
+    return var > 0 ? sqrt(var) : 0;
+}
+
+static int timing_cmd(int argc, char **argv)
+{
+    paf_timing_report_t *report;
+    const paf_timing_hist_t *hist;
+
+    if (argc == 2 && !strcmp(argv[1], "reset")) {
+        paf_timing_reset();
+        return 0;
+    }
+    if (argc != 1) {
+        printf("Usage: timing [reset]\n");
+        return 1;
+    }
+
+    // Too big for the console task's stack
+    report = malloc(sizeof(*report));
+    if (!report) {
+        printf("Out of memory\n");
+        return 1;
+    }
+    paf_timing_get_report(report);
+
+    if (!report->enabled) {
+        printf("Timing disabled, the RMT pulse backend needs "
+               "PAF_TIMING_CAPTURE_GPIO\n");
+    }
+    printf("%u edges, %u dropped, expected period %u ns, on %u ns\n",
+           report->edges, report->dropped, report->period_ns,
+           report->on_ns);
+    for (int i = 0; i < PAF_TIMING_HISTS; i++) {
+        hist = &report->hists[i];
+        printf("%s: n %u, mean %d ns, stddev %u ns, min %d ns, max %d ns\n",
+               paf_timing_hist_names[i], hist->count,
+               paf_timing_hist_mean(hist), paf_timing_hist_stddev(hist),
+               hist->min, hist->max);
+        for (int bin = 0; bin < PAF_TIMING_BINS; bin++) {
+            if (hist->bins[bin]) {
+                printf("  %s%7d ns: %u\n",
+                       bin == 0 ? "<" : bin == PAF_TIMING_BINS - 1 ?
+                       ">" : " ", paf_timing_bin_ns(bin), hist->bins[bin]);
+            }
+        }
+    }
+    free(report);
+
+    return 0;
+}
+
+void register_timing(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "timing",
+        .help = "Show the LED edge timing error histograms or reset them",
+        .hint = "[reset]",
+        .func = &timing_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
@@ -0,0 +1,87 @@
+#ifndef __PAF_TIMING_H__
+#define __PAF_TIMING_H__
+
+/**
+ * @file paf_timing.h
+ * @date 16 October 2026
+ * @brief LED edge timestamping and jitter histograms
+ *
+ * Every LED on and off transition is timestamped with the CPU cycle
+ * counter, either by a GPIO interrupt on PAF_TIMING_CAPTURE_GPIO wired back
+ * to the LED output or, without one, in the LED ISRs. The latter only sees
+ * the edges the CPU makes, so pulse trains generated by the RMT need the
+ * capture input. Without it the RMT backend leaves timing disabled and the
+ * report says so.
+ *
+ * A low priority task compares the edges of pulse trains against the
+ * configured pulse period and on time and keeps streaming histograms of
+ * the errors, in ns:
+ *
+ * - period, between consecutive rising edges
+ * - on time, from a rising edge to the next falling edge
+ * - phase, of every rising edge against the ideal schedule started by the
+ *   first edge of the train, ie. the latency error accumulated over it
+ *
+ * Bins are PAF_TIMING_BIN_NS wide and centered on 0, the outer bins also
+ * hold everything beyond them.
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#include "paf_config.h"
+
+typedef enum paf_timing_hist_id {
+    PAF_TIMING_PERIOD = 0,
+    PAF_TIMING_ON,
+    PAF_TIMING_PHASE,
+    PAF_TIMING_HISTS,
+} paf_timing_hist_id_t;
+
+typedef struct paf_timing_hist {
+    uint32_t bins[PAF_TIMING_BINS];
+    uint32_t count;
+    int32_t min; /**< ns */
+    int32_t max; /**< ns */
+    int64_t sum;
+    uint64_t sum_sq;
+} paf_timing_hist_t;
+
+typedef struct paf_timing_report {
+    unsigned char enabled; /**< 0 if the pulse edges can't be seen */
+    paf_timing_hist_t hists[PAF_TIMING_HISTS];
+    uint32_t edges; /**< Timestamped since the last reset */
+    uint32_t dropped; /**< Lost to a full edge buffer */
+    uint32_t period_ns; /**< Configured pulse period last compared against */
+    uint32_t on_ns; /**< Configured on time last compared against */
+} paf_timing_report_t;
+
+extern const char *const paf_timing_hist_names[PAF_TIMING_HISTS];
+
+esp_err_t paf_timing_init(void);
+void paf_timing_isr_led_edge(unsigned int level);
+void paf_timing_reset(void);
+void paf_timing_get_report(paf_timing_report_t *report);
+int32_t paf_timing_bin_ns(unsigned int bin);
+int32_t paf_timing_hist_mean(const paf_timing_hist_t *hist);
+uint32_t paf_timing_hist_stddev(const paf_timing_hist_t *hist);
+
+void register_timing(void);
+
+#endif // __PAF_TIMING_H__
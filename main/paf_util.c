@@ -22,12 +22,120 @@
    ----------------------------------------------------------------------
 @endverbatim
  */
+#include <string.h>
+
 #include "esp_system.h"
 #include "nvs_flash.h"
 #include "esp_console.h"
 #include "esp_wifi.h"
 #include "esp_log.h"
 
+#include "paf_util.h"
+
+/**
+ * @brief Writes the decimal representation of val without terminating it
+ *
+ * @param buf Needs room for at least 10 characters
+ * @return Number of characters written
+ */
+size_t paf_fmt_uint(char *buf, uint32_t val)
+{
+    char tmp[10];
+    size_t len = 0;
+
+    do {
+        tmp[len++] = '0' + val % 10;
+        val /= 10;
+    } while (val);
+
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = tmp[len - 1 - i];
+    }
+
+    return len;
+}
+
+static void paf_strbuf_put(paf_strbuf_t *sb, const char *str, size_t len)
+{
+    if (sb->len + len >= sb->size) {
+        sb->overflow = 1;
+        len = sb->size - 1 - sb->len;
+    }
+    memcpy(sb->buf + sb->len, str, len);
+    sb->len += len;
+    sb->buf[sb->len] = '\0';
+}
+
+void paf_strbuf_reset(paf_strbuf_t *sb)
+{
+    sb->len = 0;
+    sb->overflow = 0;
+    sb->buf[0] = '\0';
+}
+
+void paf_strbuf_puts(paf_strbuf_t *sb, const char *str)
+{
+    paf_strbuf_put(sb, str, strlen(str));
+}
+
+void paf_strbuf_putu(paf_strbuf_t *sb, uint32_t val)
+{
+    char tmp[10];
+
+    paf_strbuf_put(sb, tmp, paf_fmt_uint(tmp, val));
+}
+
+void paf_strbuf_puti(paf_strbuf_t *sb, int32_t val)
+{
+    if (val < 0) {
+        paf_strbuf_put(sb, "-", 1);
+        paf_strbuf_putu(sb, -(uint32_t)val);
+    }
+    else {
+        paf_strbuf_putu(sb, val);
+    }
+}
+
+/**
+ * @brief Appends a fixed point value, val being scaled by 10^frac_digits
+ *
+ * eg. val = 4883, frac_digits = 2 is printed as 48.83
+ */
+void paf_strbuf_putfix(paf_strbuf_t *sb, int32_t val, unsigned int frac_digits)
+{
+    char tmp[11];
+    uint32_t uval = (val < 0) ? -(uint32_t)val : val;
+    size_t len;
+
+    if (val < 0) {
+        paf_strbuf_put(sb, "-", 1);
+    }
+
+    len = paf_fmt_uint(tmp, uval);
+    if (frac_digits == 0) {
+        paf_strbuf_put(sb, tmp, len);
+        return;
+    }
+    if (frac_digits > 9) {
+        frac_digits = 9;
+    }
+
+    // Integer part, at least a single 0
+    if (len > frac_digits) {
+        paf_strbuf_put(sb, tmp, len - frac_digits);
+    }
+    else {
+        paf_strbuf_put(sb, "0", 1);
+    }
+    paf_strbuf_put(sb, ".", 1);
+    // Leading zeros of the fraction
+    for (size_t i = len; i < frac_digits; i++) {
+        paf_strbuf_put(sb, "0", 1);
+    }
+    paf_strbuf_put(sb, tmp + ((len > frac_digits) ? len - frac_digits : 0),
+                   (len > frac_digits) ? frac_digits : len);
+}
+
 //TODO
 int get_ap_ip_string(char *buf)
 {
@@ -24,6 +24,33 @@
 @endverbatim
  */
 
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Bounded, append-only text buffer on top of caller provided memory
+ *
+ * Output that does not fit is dropped and flagged in overflow, the buffer
+ * is always kept NUL terminated.
+ */
+typedef struct paf_strbuf {
+    char *buf;
+    size_t size;
+    size_t len;
+    unsigned char overflow;
+} paf_strbuf_t;
+
+#define PAF_STRBUF_INIT(ARRAY) \
+    { .buf = (ARRAY), .size = sizeof(ARRAY), .len = 0, .overflow = 0 }
+
+void paf_strbuf_reset(paf_strbuf_t *sb);
+void paf_strbuf_puts(paf_strbuf_t *sb, const char *str);
+void paf_strbuf_putu(paf_strbuf_t *sb, uint32_t val);
+void paf_strbuf_puti(paf_strbuf_t *sb, int32_t val);
+void paf_strbuf_putfix(paf_strbuf_t *sb, int32_t val, unsigned int frac_digits);
+
+size_t paf_fmt_uint(char *buf, uint32_t val);
+
 int get_ap_ip_string(char *buf);
 void register_version(void);
 void get_mac_string(char *buf);
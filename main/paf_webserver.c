@@ -23,309 +23,1095 @@
 @endverbatim
  */
 
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "esp_log.h"
 #include "esp_http_server.h"
+#include "esp_timer.h"
 
-#include "../webpages/index.h"
-#include "../webpages/bootstrap.h"
-#include "../webpages/jquery.h"
-
+#include "paf_assets.h"
 #include "paf_config.h"
+#include "paf_flash.h"
 #include "paf_led.h"
+#include "paf_plan.h"
+#include "paf_seq.h"
 #include "paf_gpio.h"
 #include "paf_test.h"
+#include "paf_timing.h"
+#include "paf_util.h"
 
 static httpd_handle_t http_server = NULL;
 
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+// Socket descriptors of the connected telemetry clients, only changed from
+// within the httpd task but the count is read by the tasks that push
+static int ws_clients[PAF_WEBSERVER_WS_MAX_CLIENTS];
+static unsigned int ws_client_count = 0;
+static portMUX_TYPE ws_clients_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static portMUX_TYPE ws_push_lock = portMUX_INITIALIZER_UNLOCKED;
+static unsigned char ws_push_queued = 0;
+static int64_t ws_last_push = 0;
+static esp_timer_handle_t ws_push_timer = NULL;
+#endif
+
 const static char http_200_hdr[] = "200 OK";
 const static char http_content_type_html[] = "text/html";
+const static char http_content_type_json[] = "application/json";
+
+/**
+ * @brief Streams an asset straight out of the memory mapped asset pack
+ */
+static esp_err_t http_server_send_asset(httpd_req_t *req,
+                                        const paf_asset_t *asset)
+{
+    char etag[20];
+    char if_none_match[sizeof(etag)];
+    size_t off, len;
+    esp_err_t ret;
+
+    snprintf(etag, sizeof(etag), "\"%08x-%x\"",
+             (unsigned int)asset->hash, (unsigned int)asset->length);
+    httpd_resp_set_hdr(req, "ETag", etag);
+    // Revalidating costs a 304 and keeps clients current after the www
+    // partition is reflashed, only assets with versioned URIs skip it
+    httpd_resp_set_hdr(req, "Cache-Control",
+                       (asset->flags & PAF_ASSETS_FLAG_IMMUTABLE) ?
+                       "public, max-age=31536000, immutable" : "no-cache");
 
-const static char get_root[] = "/";
-const static char get_bootstrap_css[] = "bootstrap.min.css";
-const static char get_jquery[] = "jquery.min.js";
-const static char get_btn_test_start[] = "btn-test-start";
-const static char get_btn_test_stop[] = "btn-test-stop";
-const static char get_btn_next[] = "btn-next";
-const static char get_btn_prev[] = "btn-prev";
-const static char get_test_status[] = "test-status";
-const static char get_test_count_total[] = "get_test_count_total";
-const static char get_test_number[] = "get_test_num";
-const static char get_test_freq[] = "get_test_freq";
-const static char get_test_dc[] = "get_test_dc";
-const static char get_test_dur[] = "get_test_dur";
-const static char get_freq[] = "get_frequency";
-const static char get_time_remaining[] = "get_time_remaining";
-const static char get_onDuration[] = "get_duration";
-const static char get_set_onDuration[] = "duration-set";
-const static char get_set_freq[] = "freq-set";
-const static char get_dutycycle[] = "get_dutycycle";
-const static char get_set_dutycycle[] = "dc-set";
-const static char get_set_GPIO[] = "GPIO-set";
-const static char post_auto_check[] = "auto-set";
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match,
+                                    sizeof(if_none_match)) == ESP_OK &&
+        strcmp(if_none_match, etag) == 0) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    httpd_resp_set_type(req, asset->type);
+    if (asset->flags & PAF_ASSETS_FLAG_GZIP) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    }
 
-int dutyCyclePercentToCounter(int duty_per)
+    for (off = 0; off < asset->length; off += len) {
+        len = asset->length - off;
+        if (len > PAF_WEBSERVER_CHUNK_SIZE) {
+            len = PAF_WEBSERVER_CHUNK_SIZE;
+        }
+        if ((ret = httpd_resp_send_chunk(req,
+                                         (const char *)asset->data + off,
+                                         len)) != ESP_OK) {
+            return ret;
+        }
+    }
+
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+int dutyCyclePercentToPpm(int duty_per)
 {
-    return (int)((float)duty_per * 8191) / 100;
+    return duty_per * (PAF_LED_DC_MAX / 100);
 }
 
-int dutyCycleCounterToPercent(int duty_cnt)
+int dutyCyclePpmToPercent(int duty_ppm)
 {
-    return (int)((float)duty_cnt * 100) / 8191;
+    return duty_ppm / (PAF_LED_DC_MAX / 100);
 }
 
-static esp_err_t http_server_get_handler(httpd_req_t *req)
+static int dutyCyclePpmToHundredths(int duty_ppm)
 {
-    ESP_LOGI(__func__, "GET %s", req->uri);
+    return (duty_ppm + PAF_LED_DC_MAX / 20000) / (PAF_LED_DC_MAX / 10000);
+}
 
-    //TODO captive portal
+/**
+ * @brief Formats a single JSON object holding everything the web UI displays
+ *
+ * The test state is taken as one snapshot so that the test number, its
+ * parameters and the remaining time always belong together.
+ */
+static void http_server_format_status(paf_strbuf_t *out)
+{
+    struct paf_test_status status;
 
-    httpd_resp_set_status(req, http_200_hdr);
-    httpd_resp_set_type(req, http_content_type_html);
-    //ROOT
-    if ((strlen(req->uri) == 1) && (strcmp(req->uri, get_root) == 0)) {
-        ESP_LOGI(__func__, "Handling GET root");
-        httpd_resp_send(req, (const char *)index_html,
-                        HTTPD_RESP_USE_STRLEN);
-        ESP_LOGI(__func__, "index.html sent");
-    }
-    else if (strlen(req->uri) > 1) {
-        if (strcmp(req->uri + sizeof(char), get_btn_test_start) == 0) {
-            ESP_LOGI(__func__, "Handling test start");
-            paf_test_run_next_test();
-            httpd_resp_send(req, NULL, 0);
-        }
-        else if (strcmp(req->uri + sizeof(char), get_bootstrap_css) ==
-                 0) {
-            httpd_resp_send(req, (const char *)bootstrap_min_css,
-                            HTTPD_RESP_USE_STRLEN);
-            ESP_LOGI(__func__, "bootstrap.min.css sent");
-        }
-        else if (strcmp(req->uri + sizeof(char), get_jquery) ==
-                 0) {
-            httpd_resp_send(req, (const char *)jquery_min_js,
-                            HTTPD_RESP_USE_STRLEN);
-            ESP_LOGI(__func__, "jquery.min.js sent");
-        }
-        else if (strcmp(req->uri + sizeof(char), get_btn_test_stop) ==
-                 0) {
-            paf_test_stop_cur_test();
-            ESP_LOGI(__func__, "Handling test stop");
-        }
-        else if (strcmp(req->uri + sizeof(char), get_btn_next) == 0) {
-            paf_test_next_test();
-            ESP_LOGI(__func__, "Handling btn next");
+    paf_test_get_status(&status);
+
+    paf_strbuf_puts(out, "{\"test\":");
+    paf_strbuf_putu(out, status.cur_test);
+    paf_strbuf_puts(out, ",\"total\":");
+    paf_strbuf_putu(out, status.num_tests);
+    paf_strbuf_puts(out, ",\"remaining\":");
+    paf_strbuf_putu(out, status.time_remaining);
+    paf_strbuf_puts(out, ",\"running\":");
+    paf_strbuf_putu(out, status.running);
+    paf_strbuf_puts(out, ",\"auto\":");
+    paf_strbuf_putu(out, status.auto_skip);
+    paf_strbuf_puts(out, ",\"freq\":");
+    paf_strbuf_putu(out, status.freq);
+    paf_strbuf_puts(out, ",\"dc\":");
+    paf_strbuf_putfix(out, dutyCyclePpmToHundredths(status.dc), 2);
+    paf_strbuf_puts(out, ",\"dur\":");
+    paf_strbuf_putu(out, status.duration);
+    paf_strbuf_puts(out, ",\"ch\":");
+    paf_strbuf_putu(out, status.channels);
+    paf_strbuf_puts(out, ",\"led\":{\"on\":");
+    paf_strbuf_puti(out, paf_led_get_led());
+    paf_strbuf_puts(out, ",\"freq\":");
+    paf_strbuf_puti(out, paf_led_get_freq());
+    paf_strbuf_puts(out, ",\"dc\":");
+    paf_strbuf_putfix(out, dutyCyclePpmToHundredths(paf_led_get_dc()),
+                      2);
+    paf_strbuf_puts(out, ",\"dur\":");
+    paf_strbuf_putu(out, paf_led_get_time());
+    paf_strbuf_puts(out, ",\"ch\":");
+    paf_strbuf_putu(out, paf_led_get_channels());
+    paf_strbuf_puts(out, ",\"applied\":");
+    paf_strbuf_puti(out,
+                    paf_led_get_applied() == paf_led_get_commit_seq());
+    paf_strbuf_puts(out, "}}");
+}
+
+static esp_err_t http_server_send_status(httpd_req_t *req,
+                                         paf_strbuf_t *scratch)
+{
+    http_server_format_status(scratch);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_send(req, scratch->buf, scratch->len);
+}
+
+/**
+ * @brief Sends the scratch buffer as a chunk, or fails the request if some
+ * of it didn't fit rather than send a truncated document
+ */
+static esp_err_t http_server_flush_chunk(httpd_req_t *req,
+                                         paf_strbuf_t *scratch)
+{
+    esp_err_t ret;
+
+    if (scratch->overflow) {
+        ESP_LOGE(__func__, "%s: chunk overflowed the scratch buffer",
+                 req->uri);
+        paf_strbuf_reset(scratch);
+        return ESP_FAIL;
+    }
+    ret = httpd_resp_send_chunk(req, scratch->buf, scratch->len);
+
+    paf_strbuf_reset(scratch);
+    return ret;
+}
+
+/**
+ * @brief Sends the LED edge timing histograms as JSON, in chunks of a few
+ * bins so they fit the scratch buffer whatever the counts
+ */
+static esp_err_t http_server_send_timing(httpd_req_t *req,
+                                         paf_strbuf_t *scratch)
+{
+    paf_timing_report_t *report = malloc(sizeof(*report));
+    const paf_timing_hist_t *hist;
+    esp_err_t ret;
+
+    if (!report) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                                   "Out of memory");
+    }
+    paf_timing_get_report(report);
+
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    paf_strbuf_puts(scratch, "{\"enabled\":");
+    paf_strbuf_puts(scratch, report->enabled ? "true" : "false");
+    paf_strbuf_puts(scratch, ",\"edges\":");
+    paf_strbuf_putu(scratch, report->edges);
+    paf_strbuf_puts(scratch, ",\"dropped\":");
+    paf_strbuf_putu(scratch, report->dropped);
+    paf_strbuf_puts(scratch, ",\"period_ns\":");
+    paf_strbuf_putu(scratch, report->period_ns);
+    paf_strbuf_puts(scratch, ",\"on_ns\":");
+    paf_strbuf_putu(scratch, report->on_ns);
+    paf_strbuf_puts(scratch, ",\"bin_ns\":");
+    paf_strbuf_putu(scratch, PAF_TIMING_BIN_NS);
+    paf_strbuf_puts(scratch, ",\"first_bin_ns\":");
+    paf_strbuf_puti(scratch, paf_timing_bin_ns(0));
+    ret = http_server_flush_chunk(req, scratch);
+
+    for (int i = 0; i < PAF_TIMING_HISTS && ret == ESP_OK; i++) {
+        hist = &report->hists[i];
+        paf_strbuf_puts(scratch, ",\"");
+        paf_strbuf_puts(scratch, paf_timing_hist_names[i]);
+        paf_strbuf_puts(scratch, "\":{\"n\":");
+        paf_strbuf_putu(scratch, hist->count);
+        paf_strbuf_puts(scratch, ",\"mean\":");
+        paf_strbuf_puti(scratch, paf_timing_hist_mean(hist));
+        paf_strbuf_puts(scratch, ",\"stddev\":");
+        paf_strbuf_putu(scratch, paf_timing_hist_stddev(hist));
+        paf_strbuf_puts(scratch, ",\"min\":");
+        paf_strbuf_puti(scratch, hist->min);
+        paf_strbuf_puts(scratch, ",\"max\":");
+        paf_strbuf_puti(scratch, hist->max);
+        paf_strbuf_puts(scratch, ",\"bins\":[");
+        for (int bin = 0; bin < PAF_TIMING_BINS && ret == ESP_OK; bin++) {
+            if (bin) {
+                paf_strbuf_puts(scratch, ",");
+            }
+            paf_strbuf_putu(scratch, hist->bins[bin]);
+            if (bin % PAF_WEBSERVER_TIMING_BINS_PER_CHUNK ==
+                PAF_WEBSERVER_TIMING_BINS_PER_CHUNK - 1) {
+                ret = http_server_flush_chunk(req, scratch);
+            }
         }
-        else if (strcmp(req->uri + sizeof(char), get_btn_prev) == 0) {
-            paf_test_prev_test();
-            ESP_LOGI(__func__, "Handling btn prev");
+        if (ret != ESP_OK) {
+            break;
         }
-        else if (strcmp(req->uri + sizeof(char),
-                        get_time_remaining) == 0) {
-            sprintf((char *)req->uri, "%d",
-                    paf_test_get_time_remaining());
-            ESP_LOGI(__func__, "Handling get time remaining: %s",
-                     req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+        paf_strbuf_puts(scratch, "]}");
+        ret = http_server_flush_chunk(req, scratch);
+    }
+    free(report);
+
+    if (ret == ESP_OK) {
+        paf_strbuf_puts(scratch, "}");
+        ret = http_server_flush_chunk(req, scratch);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+static void ws_remove_client(int fd)
+{
+    unsigned char removed = 0;
+
+    portENTER_CRITICAL(&ws_clients_lock);
+    for (int i = 0; i < ws_client_count; i++) {
+        if (ws_clients[i] == fd) {
+            ws_clients[i] = ws_clients[--ws_client_count];
+            removed = 1;
+            break;
         }
-        else if (strcmp(req->uri + sizeof(char), get_test_status) ==
-                 0) {
-            ESP_LOGI(__func__, "Handling test status");
-            if (paf_test_get_time_remaining())
-                httpd_resp_send(req, "RUNNING",
-                                HTTPD_RESP_USE_STRLEN);
-            else
-                httpd_resp_send(req, "STOPPED",
-                                HTTPD_RESP_USE_STRLEN);
+    }
+    portEXIT_CRITICAL(&ws_clients_lock);
+
+    if (removed) {
+        ESP_LOGI(__func__, "Telemetry client %d removed", fd);
+    }
+}
+
+static unsigned int ws_get_client_count(void)
+{
+    unsigned int count;
+
+    portENTER_CRITICAL(&ws_clients_lock);
+    count = ws_client_count;
+    portEXIT_CRITICAL(&ws_clients_lock);
+
+    return count;
+}
+
+/**
+ * @brief Runs in the httpd task, sends one status snapshot to every client
+ */
+static void ws_broadcast(void *arg)
+{
+    char buf[PAF_WEBSERVER_SCRATCH_SIZE];
+    paf_strbuf_t out = PAF_STRBUF_INIT(buf);
+    int clients[PAF_WEBSERVER_WS_MAX_CLIENTS];
+    unsigned int count;
+    httpd_ws_frame_t frame = {
+        .final = true,
+        .type = HTTPD_WS_TYPE_TEXT,
+        .payload = (uint8_t *)buf,
+    };
+
+    portENTER_CRITICAL(&ws_push_lock);
+    ws_push_queued = 0;
+    ws_last_push = esp_timer_get_time();
+    portEXIT_CRITICAL(&ws_push_lock);
+
+    http_server_format_status(&out);
+    frame.len = out.len;
+
+    portENTER_CRITICAL(&ws_clients_lock);
+    count = ws_client_count;
+    memcpy(clients, ws_clients, count * sizeof(clients[0]));
+    portEXIT_CRITICAL(&ws_clients_lock);
+
+    for (int i = 0; i < count; i++) {
+        if (httpd_ws_send_frame_async(http_server, clients[i],
+                                      &frame) != ESP_OK) {
+            ws_remove_client(clients[i]);
         }
-        else if (strcmp(req->uri + sizeof(char), get_freq) == 0) {
-            sprintf((char *)req->uri, "%d", paf_led_get_freq());
-            ESP_LOGI(__func__, "Handling freq: %s", req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+    }
+}
+
+static void ws_queue_broadcast(void)
+{
+    portENTER_CRITICAL(&ws_push_lock);
+    if (ws_push_queued) {
+        portEXIT_CRITICAL(&ws_push_lock);
+        return;
+    }
+    ws_push_queued = 1;
+    portEXIT_CRITICAL(&ws_push_lock);
+
+    if (httpd_queue_work(http_server, ws_broadcast, NULL) != ESP_OK) {
+        portENTER_CRITICAL(&ws_push_lock);
+        ws_push_queued = 0;
+        portEXIT_CRITICAL(&ws_push_lock);
+    }
+}
+
+static void ws_push_timer_cb(void *arg)
+{
+    ws_queue_broadcast();
+}
+
+/**
+ * @brief Pushes a status snapshot to the telemetry clients
+ *
+ * Pushes are limited to one per PAF_WEBSERVER_WS_MIN_INTERVAL_MS regardless
+ * of the number of clients or events. Ticks that fall inside that window
+ * are dropped as the next push carries a fresh snapshot anyway, state
+ * changes are deferred until the window has passed.
+ */
+static void ws_request_push(unsigned char state_change)
+{
+    int64_t wait_us;
+
+    if (!ws_get_client_count()) {
+        return;
+    }
+
+    portENTER_CRITICAL(&ws_push_lock);
+    wait_us = ws_last_push + PAF_WEBSERVER_WS_MIN_INTERVAL_MS * 1000 -
+              esp_timer_get_time();
+    portEXIT_CRITICAL(&ws_push_lock);
+
+    if (wait_us <= 0) {
+        ws_queue_broadcast();
+    }
+    else if (state_change) {
+        // Already armed timers keep their deadline
+        esp_timer_start_once(ws_push_timer, wait_us);
+    }
+}
+
+static void ws_test_event(paf_test_event_t event)
+{
+    ws_request_push(event != PAF_TEST_EVENT_TICK);
+}
+
+/**
+ * @brief Lets the clients know once new PWM parameters are on the LED
+ */
+static void ws_led_applied(uint32_t seq)
+{
+    ws_request_push(1);
+}
+
+static esp_err_t http_server_ws_handler(httpd_req_t *req)
+{
+    httpd_ws_frame_t frame = { 0 };
+    uint8_t buf[16];
+    int fd = httpd_req_to_sockfd(req);
+
+    if (req->method == HTTP_GET) {
+        portENTER_CRITICAL(&ws_clients_lock);
+        if (ws_client_count < PAF_WEBSERVER_WS_MAX_CLIENTS) {
+            ws_clients[ws_client_count++] = fd;
+            fd = -1;
         }
-        else if (strcmp(req->uri + sizeof(char), get_dutycycle) ==
-                 0) {
-            sprintf((char *)req->uri, "%d",
-                    dutyCycleCounterToPercent(paf_led_get_dc()));
-            ESP_LOGI(__func__, "Handling dc: %s", req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+        portEXIT_CRITICAL(&ws_clients_lock);
+
+        if (fd != -1) {
+            ESP_LOGI(__func__, "Telemetry client limit reached");
+            return ESP_FAIL;
         }
-        else if (strcmp(req->uri + sizeof(char), get_onDuration) ==
-                 0) {
-            sprintf((char *)req->uri, "%d", paf_led_get_time());
-            ESP_LOGI(__func__, "Handling on duration: %s",
-                     req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+        ESP_LOGI(__func__, "Telemetry client %d added",
+                 httpd_req_to_sockfd(req));
+        ws_queue_broadcast();
+        return ESP_OK;
+    }
+
+    // Clients don't send anything meaningful, drain and discard
+    frame.payload = buf;
+    return httpd_ws_recv_frame(req, &frame, sizeof(buf));
+}
+
+static void http_server_close_fn(httpd_handle_t hd, int sockfd)
+{
+    ws_remove_client(sockfd);
+    close(sockfd);
+}
+
+static const httpd_uri_t http_ws_request = {
+    .uri = "/api/ws",
+    .method = HTTP_GET,
+    .handler = http_server_ws_handler,
+    .user_ctx = NULL,
+    .is_websocket = true,
+};
+#endif
+
+static esp_err_t http_server_send_int(httpd_req_t *req,
+                                      paf_strbuf_t *scratch, int32_t val)
+{
+    paf_strbuf_puti(scratch, val);
+    return httpd_resp_send(req, scratch->buf, scratch->len);
+}
+
+/**
+ * @brief Receives the whole request body into the scratch buffer
+ *
+ * Bodies that don't fit are rejected with 413 as none of the endpoints
+ * expects more than a handful of characters.
+ */
+static esp_err_t http_server_recv_body(httpd_req_t *req,
+                                       paf_strbuf_t *scratch)
+{
+    size_t received = 0;
+    int ret;
+
+    if (req->content_len >= scratch->size) {
+        httpd_resp_set_status(req, "413 Payload Too Large");
+        httpd_resp_send(req, NULL, 0);
+        return ESP_FAIL;
+    }
+
+    while (received < req->content_len) {
+        ret = httpd_req_recv(req, scratch->buf + received,
+                             req->content_len - received);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
         }
-        else if (strcmp(req->uri + sizeof(char),
-                        get_test_count_total) == 0) {
-            sprintf((char *)req->uri, "%d",
-                    paf_test_get_test_count_total());
-            ESP_LOGI(__func__, "Handling get total test count: %s",
-                     req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+        if (ret <= 0) {
+            return ESP_FAIL;
         }
-        else if (strcmp(req->uri + sizeof(char), get_test_number) ==
-                 0) {
-            sprintf((char *)req->uri, "%d",
-                    paf_test_get_cur_test());
-            ESP_LOGI(__func__, "Handling get test num: %s",
-                     req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+        received += ret;
+    }
+    scratch->buf[received] = '\0';
+    scratch->len = received;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Reads a request body consisting of a single unsigned integer
+ */
+static esp_err_t http_server_recv_uint(httpd_req_t *req,
+                                       paf_strbuf_t *scratch,
+                                       unsigned int *val)
+{
+    char *end;
+
+    if (http_server_recv_body(req, scratch) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    *val = (unsigned int)strtoul(scratch->buf, &end, 10);
+    paf_strbuf_reset(scratch);
+    if (end == scratch->buf) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, NULL);
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+static esp_err_t get_test_start(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    ESP_LOGI(__func__, "Handling test start");
+    if (paf_test_run_next_test() != ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                                   "Couldn't start test");
+    }
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t get_test_stop(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    ESP_LOGI(__func__, "Handling test stop");
+    paf_test_stop_cur_test();
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t get_seq_start(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    esp_err_t err = paf_seq_start(1);
+
+    if (err != ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                   esp_err_to_name(err));
+    }
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t get_seq_stop(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    paf_seq_stop();
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t get_next(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    paf_test_next_test();
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t get_prev(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    paf_test_prev_test();
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t get_test_status(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return httpd_resp_send(req, paf_test_get_time_remaining() ?
+                           "RUNNING" : "STOPPED", HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t get_time_remaining(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch, paf_test_get_time_remaining());
+}
+
+static esp_err_t get_freq(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch, paf_led_get_freq());
+}
+
+static esp_err_t get_dutycycle(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch,
+                                dutyCyclePpmToPercent(paf_led_get_dc()));
+}
+
+static esp_err_t get_duration(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch, paf_led_get_time());
+}
+
+static esp_err_t get_test_count_total(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch, paf_test_get_test_count_total());
+}
+
+static esp_err_t get_test_num(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch, paf_test_get_cur_test());
+}
+
+static esp_err_t get_test_freq(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch, paf_test_get_cur_freq());
+}
+
+static esp_err_t get_test_dc(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch,
+                                dutyCyclePpmToPercent(paf_test_get_cur_dc()));
+}
+
+static esp_err_t get_test_dur(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    return http_server_send_int(req, scratch, paf_test_get_cur_dur());
+}
+
+static esp_err_t post_dutycycle(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    unsigned int new_dc;
+    esp_err_t err;
+
+    if (http_server_recv_uint(req, scratch, &new_dc) != ESP_OK) {
+        return ESP_OK;
+    }
+    ESP_LOGI(__func__, "Handling set dc: %u", new_dc);
+    if (new_dc > 100) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "dc");
+    }
+    if ((err = paf_led_set_dc(dutyCyclePercentToPpm(new_dc))) != ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                   esp_err_to_name(err));
+    }
+    paf_flash_save_settings();
+    return httpd_resp_send(req, "DC Set", HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t post_freq(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    unsigned int new_freq;
+    esp_err_t err;
+
+    if (http_server_recv_uint(req, scratch, &new_freq) != ESP_OK) {
+        return ESP_OK;
+    }
+    ESP_LOGI(__func__, "Handling set freq: %u", new_freq);
+    if ((err = paf_led_set_freq(new_freq)) != ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                   esp_err_to_name(err));
+    }
+    paf_flash_save_settings();
+    return httpd_resp_send(req, "Freq Set", HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t post_auto_check(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    unsigned int auto_check;
+
+    if (http_server_recv_uint(req, scratch, &auto_check) != ESP_OK) {
+        return ESP_OK;
+    }
+    ESP_LOGI(__func__, "Handling post auto-check: %u", auto_check);
+    if (auto_check) {
+        paf_test_set_auto_skip();
+    }
+    else {
+        paf_test_unset_auto_skip();
+    }
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t post_duration(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    unsigned int new_onTime;
+    esp_err_t err;
+
+    if (http_server_recv_uint(req, scratch, &new_onTime) != ESP_OK) {
+        return ESP_OK;
+    }
+    ESP_LOGI(__func__, "Handling set on-duration: %u", new_onTime);
+    // Validated like /api/config, a zero duration is refused
+    if ((err = paf_led_set_config(PAF_LED_CFG_TIME, 0, 0, new_onTime, 0)) !=
+        ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                   esp_err_to_name(err));
+    }
+    paf_flash_save_settings();
+    return httpd_resp_send(req, "Duration Set", HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t post_gpio(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    unsigned int GPIO_Pin;
+
+    if (http_server_recv_uint(req, scratch, &GPIO_Pin) != ESP_OK) {
+        return ESP_OK;
+    }
+    ESP_LOGI(__func__, "GPIO Pin %u toggled", GPIO_Pin);
+    paf_gpio_toggle_state(GPIO_Pin);
+    return httpd_resp_send(req, "GPIO Toggled", HTTPD_RESP_USE_STRLEN);
+}
+
+/**
+ * @brief Reads an unsigned integer parameter from a key=value&... body
+ *
+ * @return 1 if the key is present and valid, 0 if absent and -1 if present
+ * but not a number
+ */
+static int http_server_body_uint(const char *body, const char *key,
+                                 unsigned int *val)
+{
+    char buf[12];
+    char *end;
+
+    if (httpd_query_key_value(body, key, buf, sizeof(buf)) != ESP_OK) {
+        return 0;
+    }
+    *val = (unsigned int)strtoul(buf, &end, 10);
+
+    return (end != buf && *end == '\0') ? 1 : -1;
+}
+
+/**
+ * @brief Applies any subset of freq (Hz), dc (%), dur (ms) and ch (LED
+ * channel mask) at once, eg. "freq=100&dc=50"
+ */
+static esp_err_t post_config(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    static const struct {
+        const char *key;
+        unsigned int flag;
+    } params[] = {
+        { "freq", PAF_LED_CFG_FREQ },
+        { "dc", PAF_LED_CFG_DC },
+        { "dur", PAF_LED_CFG_TIME },
+        { "ch", PAF_LED_CFG_CH },
+    };
+    unsigned int vals[4] = { 0 };
+    unsigned int mask = 0;
+    esp_err_t err;
+    int ret;
+
+    if (http_server_recv_body(req, scratch) != ESP_OK) {
+        return ESP_OK;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        if ((ret = http_server_body_uint(scratch->buf, params[i].key,
+                                         &vals[i])) < 0) {
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                       params[i].key);
         }
-        else if (strcmp(req->uri + sizeof(char), get_test_freq) ==
-                 0) {
-            sprintf((char *)req->uri, "%d",
-                    paf_test_get_cur_freq());
-            ESP_LOGI(__func__, "Handling get test freq: %s",
-                     req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+        if (ret) {
+            mask |= params[i].flag;
         }
-        else if (strcmp(req->uri + sizeof(char), get_test_dc) ==
-                 0) {
-            sprintf((char *)req->uri, "%d",
-                    paf_test_get_cur_dc());
-            ESP_LOGI(__func__, "Handling get test dc: %s",
-                     req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+    }
+    paf_strbuf_reset(scratch);
+
+    if ((mask & PAF_LED_CFG_DC) && vals[1] > 100) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "dc");
+    }
+
+    err = paf_led_set_config(mask, vals[0],
+                             dutyCyclePercentToPpm(vals[1]), vals[2],
+                             vals[3]);
+    if (err != ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                   esp_err_to_name(err));
+    }
+    paf_flash_save_settings();
+
+    return httpd_resp_send(req, "Config Set", HTTPD_RESP_USE_STRLEN);
+}
+
+/**
+ * @brief CSV unless the body is sent as application/octet-stream
+ */
+static paf_plan_format_t http_server_body_format(httpd_req_t *req,
+                                                 paf_strbuf_t *scratch)
+{
+    if (httpd_req_get_hdr_value_str(req, "Content-Type", scratch->buf,
+                                    scratch->size) == ESP_OK &&
+        !strncmp(scratch->buf, "application/octet-stream",
+                 strlen("application/octet-stream"))) {
+        return PAF_PLAN_FORMAT_BIN;
+    }
+
+    return PAF_PLAN_FORMAT_CSV;
+}
+
+/**
+ * @brief Hands the body to feed piece by piece as it arrives, stops early
+ * once feed fails
+ *
+ * Whatever is left of the body after that is discarded by the server once
+ * the handler returns.
+ *
+ * @return ESP_FAIL if the connection broke
+ */
+static esp_err_t http_server_stream_body(httpd_req_t *req,
+        paf_strbuf_t *scratch,
+        esp_err_t (*feed)(void *ctx, const char *data, size_t len),
+        void *ctx)
+{
+    size_t remaining = req->content_len;
+    int ret;
+
+    while (remaining) {
+        ret = httpd_req_recv(req, scratch->buf, remaining < scratch->size ?
+                             remaining : scratch->size);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
         }
-        else if (strcmp(req->uri + sizeof(char), get_test_dur) ==
-                 0) {
-            sprintf((char *)req->uri, "%d",
-                    paf_test_get_cur_dur());
-            ESP_LOGI(__func__, "Handling get test dur: %s",
-                     req->uri);
-            httpd_resp_send(req, (const char *)req->uri,
-                            HTTPD_RESP_USE_STRLEN);
+        if (ret <= 0) {
+            return ESP_FAIL;
         }
-        else {
-            ESP_LOGI(__func__, "Unhandled GET");
-            httpd_resp_send(req, NULL, 0);
+        remaining -= ret;
+        if (feed(ctx, scratch->buf, ret) != ESP_OK) {
+            break;
         }
     }
-    else {
-        httpd_resp_send(req, NULL, 0);
-    }
+    paf_strbuf_reset(scratch);
+
     return ESP_OK;
 }
 
-static esp_err_t http_server_post(httpd_req_t *req)
+/**
+ * @brief Responds 400 with where and why an upload was rejected
+ */
+static esp_err_t http_server_send_rejected(httpd_req_t *req,
+                                           paf_strbuf_t *scratch,
+                                           paf_plan_format_t format,
+                                           unsigned int line,
+                                           const char *error)
 {
-    static char content_buf[20];
-    int ret;
+    paf_strbuf_puts(scratch, format == PAF_PLAN_FORMAT_CSV ?
+                    "Line " : "Record ");
+    paf_strbuf_putu(scratch, line);
+    paf_strbuf_puts(scratch, ": ");
+    paf_strbuf_puts(scratch, error);
+    ESP_LOGW(__func__, "Rejected upload, %s", scratch->buf);
 
-    ESP_LOGI(__func__, "POST %s", req->uri);
-
-    if (strlen(req->uri) > 1) {
-        ret = httpd_req_recv(req, content_buf, req->content_len);
-        if (ret <= 20) {
-            content_buf[ret] = '\0';
-            ESP_LOGI(__func__, "POST recv %d bytes", ret);
-            if (ret > 0) {
-                if (strcmp(req->uri + sizeof(char),
-                           get_set_dutycycle) == 0) {
-                    unsigned int new_dc =
-                        (unsigned int)strtoul(
-                            content_buf, NULL, 10);
-                    ESP_LOGI(__func__,
-                             "Handling set dc: %u", new_dc);
-                    paf_led_set_dc(
-                        dutyCyclePercentToCounter(
-                            new_dc));
-                    httpd_resp_send(req, "DC Set",
-                                    HTTPD_RESP_USE_STRLEN);
-                }
-                else if (strcmp(req->uri + sizeof(char),
-                                get_set_freq) == 0) {
-                    unsigned int new_freq =
-                        (unsigned int)strtoul(
-                            content_buf, NULL, 10);
-                    ESP_LOGI(__func__,
-                             "Handling set freq: %u",
-                             new_freq);
-                    paf_led_set_freq(new_freq);
-                    httpd_resp_send(req, "Freq Set",
-                                    HTTPD_RESP_USE_STRLEN);
-                }
-                else if (strcmp(req->uri + sizeof(char),
-                                post_auto_check) == 0) {
-                    unsigned int auto_check =
-                        (unsigned int)strtoul(
-                            content_buf, NULL, 10);
-                    ESP_LOGI(__func__,
-                             "Handling post auto-check: %u",
-                             auto_check);
-                    if (auto_check) {
-                        paf_test_set_auto_skip();
-                    }
-                    else {
-                        paf_test_unset_auto_skip();
-                    }
-                }
-                else if (strcmp(req->uri + sizeof(char),
-                                get_set_onDuration) == 0) {
-                    unsigned int new_onTime =
-                        (unsigned int)strtoul(
-                            content_buf, NULL, 10);
-                    ESP_LOGI(__func__,
-                             "Handling set on-duration: %u",
-                             new_onTime);
-                    paf_led_set_time(new_onTime);
-                    httpd_resp_send(req, "Duration Set",
-                                    HTTPD_RESP_USE_STRLEN);
-                }
-                else if (strcmp(req->uri + sizeof(char),
-                                get_set_GPIO) == 0) {
-                    unsigned int GPIO_Pin =
-                        (unsigned int)strtoul(
-                            content_buf, NULL, 10);
-                    ESP_LOGI(__func__,
-                             "GPIO Pin %u toggled",
-                             GPIO_Pin);
-                    paf_gpio_toggle_state(GPIO_Pin);
-                    httpd_resp_send(req, "GPIO Toggled",
-                                    HTTPD_RESP_USE_STRLEN);
-                }
-                else {
-                    ESP_LOGI(__func__, "Unhandled POST");
-                }
-            }
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, scratch->buf);
+}
+
+static esp_err_t post_plan_feed(void *parser, const char *data, size_t len)
+{
+    return paf_plan_parser_feed(parser, data, len);
+}
+
+/**
+ * @brief Replaces the test plan, the body is parsed as it arrives
+ *
+ * The body is CSV unless sent as application/octet-stream, see paf_plan.h
+ * for both formats. Responds with the number of tests loaded.
+ */
+static esp_err_t post_plan(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    paf_plan_format_t format = http_server_body_format(req, scratch);
+    paf_plan_parser_t parser;
+    unsigned int num_tests;
+    esp_err_t err;
+
+    if (paf_plan_parser_init(&parser, format, req->content_len) != ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                                   parser.error);
+    }
+
+    if (http_server_stream_body(req, scratch, post_plan_feed,
+                                &parser) != ESP_OK) {
+        paf_plan_parser_abort(&parser);
+        return ESP_FAIL;
+    }
+
+    if (paf_plan_parser_finish(&parser) != ESP_OK) {
+        paf_plan_parser_abort(&parser);
+        return http_server_send_rejected(req, scratch, format, parser.line,
+                                         parser.error);
+    }
+
+    num_tests = parser.plan.num_tests;
+    if ((err = paf_plan_parser_commit(&parser)) != ESP_OK) {
+        paf_plan_parser_abort(&parser);
+        ESP_LOGW(__func__, "Plan not saved\n-> %s", esp_err_to_name(err));
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                                   "Couldn't save plan");
+    }
+
+    return http_server_send_int(req, scratch, num_tests);
+}
+
+static esp_err_t post_seq_feed(void *loader, const char *data, size_t len)
+{
+    return paf_seq_loader_feed(loader, data, len);
+}
+
+/**
+ * @brief Replaces the sequence, see paf_seq.h for the formats. Responds with
+ * the number of segments loaded.
+ */
+static esp_err_t post_seq(httpd_req_t *req, paf_strbuf_t *scratch)
+{
+    paf_plan_format_t format = http_server_body_format(req, scratch);
+    paf_seq_loader_t loader;
+    unsigned int count;
+
+    if (paf_seq_loader_init(&loader, format, req->content_len) != ESP_OK) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                                   loader.error);
+    }
+
+    if (http_server_stream_body(req, scratch, post_seq_feed,
+                                &loader) != ESP_OK) {
+        paf_seq_loader_abort(&loader);
+        return ESP_FAIL;
+    }
+
+    if (paf_seq_loader_finish(&loader) != ESP_OK) {
+        paf_seq_loader_abort(&loader);
+        return http_server_send_rejected(req, scratch, format, loader.line,
+                                         loader.error);
+    }
+
+    count = loader.count;
+    if (paf_seq_loader_commit(&loader) != ESP_OK) {
+        paf_seq_loader_abort(&loader);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                                   "Sequencer not running");
+    }
+
+    return http_server_send_int(req, scratch, count);
+}
+
+struct http_route {
+    const char *uri;
+    httpd_method_t method;
+    const char *type;
+    esp_err_t (*handler)(httpd_req_t *req, paf_strbuf_t *scratch);
+};
+
+static const struct http_route http_routes[] = {
+    { "/api/status", HTTP_GET, http_content_type_json,
+      http_server_send_status },
+    { "/api/timing", HTTP_GET, http_content_type_json,
+      http_server_send_timing },
+    { "/btn-test-start", HTTP_GET, http_content_type_html, get_test_start },
+    { "/btn-test-stop", HTTP_GET, http_content_type_html, get_test_stop },
+    { "/btn-seq-start", HTTP_GET, http_content_type_html, get_seq_start },
+    { "/btn-seq-stop", HTTP_GET, http_content_type_html, get_seq_stop },
+    { "/btn-next", HTTP_GET, http_content_type_html, get_next },
+    { "/btn-prev", HTTP_GET, http_content_type_html, get_prev },
+    { "/test-status", HTTP_GET, http_content_type_html, get_test_status },
+    { "/get_test_count_total", HTTP_GET, http_content_type_html,
+      get_test_count_total },
+    { "/get_test_num", HTTP_GET, http_content_type_html, get_test_num },
+    { "/get_test_freq", HTTP_GET, http_content_type_html, get_test_freq },
+    { "/get_test_dc", HTTP_GET, http_content_type_html, get_test_dc },
+    { "/get_test_dur", HTTP_GET, http_content_type_html, get_test_dur },
+    { "/get_frequency", HTTP_GET, http_content_type_html, get_freq },
+    { "/get_time_remaining", HTTP_GET, http_content_type_html,
+      get_time_remaining },
+    { "/get_duration", HTTP_GET, http_content_type_html, get_duration },
+    { "/get_dutycycle", HTTP_GET, http_content_type_html, get_dutycycle },
+    { "/api/config", HTTP_POST, http_content_type_html, post_config },
+    { "/api/plan", HTTP_POST, http_content_type_html, post_plan },
+    { "/api/seq", HTTP_POST, http_content_type_html, post_seq },
+    { "/duration-set", HTTP_POST, http_content_type_html, post_duration },
+    { "/freq-set", HTTP_POST, http_content_type_html, post_freq },
+    { "/dc-set", HTTP_POST, http_content_type_html, post_dutycycle },
+    { "/GPIO-set", HTTP_POST, http_content_type_html, post_gpio },
+    { "/auto-set", HTTP_POST, http_content_type_html, post_auto_check },
+};
+
+#define HTTP_ROUTE_COUNT (sizeof(http_routes) / sizeof(http_routes[0]))
+// Power of two and at least twice the number of routes to keep the probe
+// sequences short
+#define HTTP_ROUTE_SLOTS 64
+
+// Open addressing hash table of route index + 1, 0 marks an empty slot
+static uint8_t http_route_slots[HTTP_ROUTE_SLOTS];
+
+/**
+ * @brief FNV-1a over the path part of the URI, the query string is ignored
+ */
+static uint32_t http_route_hash(const char *uri, httpd_method_t method,
+                                size_t *len)
+{
+    uint32_t hash = 2166136261 ^ method;
+    const char *p;
+
+    for (p = uri; *p && *p != '?'; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619;
+    }
+    *len = p - uri;
+
+    return hash;
+}
+
+static void http_routes_init(void)
+{
+    size_t len;
+    uint32_t slot;
+
+    _Static_assert(HTTP_ROUTE_COUNT * 2 <= HTTP_ROUTE_SLOTS,
+                   "HTTP_ROUTE_SLOTS too small");
+
+    for (int i = 0; i < HTTP_ROUTE_COUNT; i++) {
+        slot = http_route_hash(http_routes[i].uri, http_routes[i].method,
+                               &len);
+        while (http_route_slots[slot & (HTTP_ROUTE_SLOTS - 1)]) {
+            slot++;
         }
+        http_route_slots[slot & (HTTP_ROUTE_SLOTS - 1)] = i + 1;
     }
-    return ESP_OK;
+}
+
+static const struct http_route *http_route_find(const char *uri,
+                                                httpd_method_t method)
+{
+    const struct http_route *route;
+    size_t len;
+    uint32_t slot = http_route_hash(uri, method, &len);
+    uint8_t idx;
+
+    while ((idx = http_route_slots[slot & (HTTP_ROUTE_SLOTS - 1)])) {
+        route = &http_routes[idx - 1];
+        if (route->method == method && strncmp(route->uri, uri, len) == 0 &&
+            route->uri[len] == '\0') {
+            return route;
+        }
+        slot++;
+    }
+
+    return NULL;
+}
+
+static esp_err_t http_server_handler(httpd_req_t *req)
+{
+    const struct http_route *route;
+    paf_asset_t asset;
+    // Per request scratch memory for bodies and responses, living on the
+    // stack of the worker handling the request keeps handlers reentrant
+    char scratch_buf[PAF_WEBSERVER_SCRATCH_SIZE];
+    paf_strbuf_t scratch = PAF_STRBUF_INIT(scratch_buf);
+
+    ESP_LOGD(__func__, "%s %s", req->method == HTTP_GET ? "GET" : "POST",
+             req->uri);
+
+    //TODO captive portal
+
+    if ((route = http_route_find(req->uri, req->method)) != NULL) {
+        httpd_resp_set_status(req, http_200_hdr);
+        httpd_resp_set_type(req, route->type);
+        return route->handler(req, &scratch);
+    }
+
+    if (req->method == HTTP_GET &&
+        paf_assets_find(req->uri, &asset) == ESP_OK) {
+        return http_server_send_asset(req, &asset);
+    }
+
+    ESP_LOGI(__func__, "Unhandled %s %s",
+             req->method == HTTP_GET ? "GET" : "POST", req->uri);
+    return httpd_resp_send_404(req);
 }
 
 static const httpd_uri_t http_post_request = {
     .uri = "*",
     .method = HTTP_POST,
-    .handler = http_server_post,
+    .handler = http_server_handler,
 };
 
 static const httpd_uri_t http_get_request = {
     .uri = "*",
     .method = HTTP_GET,
-    .handler = http_server_get_handler,
+    .handler = http_server_handler,
     .user_ctx = NULL,
 };
 
 int paf_webserver_init(void)
 {
     if (http_server == NULL) {
+        http_routes_init();
+        if (paf_assets_init() != ESP_OK) {
+            ESP_LOGE(__func__, "Web UI unavailable, flash the '%s' "
+                     "partition", PAF_ASSETS_PARTITION);
+        }
+
         httpd_config_t http_config = HTTPD_DEFAULT_CONFIG();
         http_config.uri_match_fn = httpd_uri_match_wildcard;
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+        http_config.close_fn = http_server_close_fn;
+#endif
 
         if (httpd_start(&http_server, &http_config) == ESP_OK) {
             ESP_LOGI(__func__, "Webserver started");
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+            // Must be registered before the wildcard handlers
+            httpd_register_uri_handler(http_server, &http_ws_request);
+            const esp_timer_create_args_t ws_timer_args = {
+                .callback = ws_push_timer_cb,
+                .name = "ws_push",
+            };
+            ESP_ERROR_CHECK(esp_timer_create(&ws_timer_args,
+                                             &ws_push_timer));
+            paf_test_register_event_cb(ws_test_event);
+            paf_led_register_applied_cb(ws_led_applied);
+            ESP_LOGI(__func__, "Webserver telemetry handler registered");
+#endif
             httpd_register_uri_handler(http_server,
                                        &http_get_request);
             ESP_LOGI(__func__, "Webverser GET handlers registered");
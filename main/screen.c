@@ -18,14 +18,38 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "freertos/timers.h"
+
+// Writers may run before screen_init() has created the lock
+#define SCREEN_FB_LOCK()                                                       \
+    do {                                                                       \
+        if (screen_dev.framebuffer_lock)                                       \
+            xSemaphoreTake(screen_dev.framebuffer_lock, portMAX_DELAY);        \
+    } while (0)
+#define SCREEN_FB_UNLOCK()                                                     \
+    do {                                                                       \
+        if (screen_dev.framebuffer_lock)                                       \
+            xSemaphoreGive(screen_dev.framebuffer_lock);                       \
+    } while (0)
+#else
+#define SCREEN_FB_LOCK()
+#define SCREEN_FB_UNLOCK()
 #endif
 
 typedef struct screen_device {
     int rows;
     int cols;
 
-    char **framebuffer;
+    // The text is kept in a ring of line_capacity lines of line_len
+    // characters, allocated once by screen_init(). Logical line 0 is the
+    // oldest, adding a line to a full ring drops it
+    char *lines;
+    unsigned char *line_set; /**< Unset lines are skipped when drawing */
+    int line_len;
+    int line_capacity;
+    int line_head;
     int fb_row_count;
+    // Lines handed to draw_text, filled in on every refresh
+    char **view;
 
 #ifdef FREERTOS
     SemaphoreHandle_t framebuffer_lock;
@@ -71,6 +95,83 @@ void screen_cursor_callback(TimerHandle_t timer)
 }
 #endif
 
+static int screen_line_slot(int line)
+{
+    return (screen_dev.line_head + line) % screen_dev.line_capacity;
+}
+
+static char *screen_line_text(int line)
+{
+    return &screen_dev.lines[screen_line_slot(line) *
+                                                    (screen_dev.line_len + 1)];
+}
+
+static char *screen_get_framebuffer_line(int line)
+{
+    if (line < 0 || line >= screen_dev.fb_row_count ||
+        !screen_dev.line_set[screen_line_slot(line)]) {
+        return NULL;
+    }
+    return screen_line_text(line);
+}
+
+static void screen_set_line(int line, const char *text)
+{
+    char *dst = screen_line_text(line);
+
+    strncpy(dst, text, screen_dev.line_len);
+    dst[screen_dev.line_len] = '\0';
+    screen_dev.line_set[screen_line_slot(line)] = 1;
+}
+
+static void screen_copy_line(int to, int from)
+{
+    memcpy(screen_line_text(to), screen_line_text(from),
+           screen_dev.line_len + 1);
+    screen_dev.line_set[screen_line_slot(to)] =
+        screen_dev.line_set[screen_line_slot(from)];
+}
+
+// Appends an unset line, dropping the oldest one if the ring is full
+static int screen_append_line(void)
+{
+    int line;
+
+    if (screen_dev.fb_row_count == screen_dev.line_capacity) {
+        screen_dev.line_head =
+            (screen_dev.line_head + 1) % screen_dev.line_capacity;
+        screen_dev.fb_row_count--;
+        if (screen_dev.cursor_location_y) {
+            screen_dev.cursor_location_y--;
+        }
+    }
+
+    line = screen_dev.fb_row_count++;
+    screen_line_text(line)[0] = '\0';
+    screen_dev.line_set[screen_line_slot(line)] = 0;
+
+    return line;
+}
+
+// Appends unset lines up to index, returns where index ended up after any
+// old lines were dropped to make room
+static int screen_extend_to(int index)
+{
+    int missing = index + 1 - screen_dev.fb_row_count;
+
+    if (missing <= 0) {
+        return index;
+    }
+    if (missing > screen_dev.line_capacity) {
+        missing = screen_dev.line_capacity;
+    }
+    while (missing--) {
+        screen_append_line();
+    }
+
+    return screen_dev.fb_row_count - 1;
+}
+
 void screen_move_cursor_left(void)
 {
     if (!screen_dev.cursor_location_x) {
@@ -92,13 +193,11 @@ int screen_get_cursor_y(void)
 
 void screen_move_cursor_right(void)
 {
-    if (screen_dev.framebuffer)
-        if (screen_dev.framebuffer[screen_dev.cursor_location_y])
-            if (screen_dev.cursor_location_x <
-                strlen(screen_dev.framebuffer
-                       [screen_dev.cursor_location_y])) {
-                screen_dev.cursor_location_x++;
-            }
+    char *line = screen_get_framebuffer_line(screen_dev.cursor_location_y);
+
+    if (line && screen_dev.cursor_location_x < strlen(line)) {
+        screen_dev.cursor_location_x++;
+    }
 }
 
 void screen_move_cursor_up(void)
@@ -120,47 +219,47 @@ void screen_move_cursor_start(void)
     screen_dev.cursor_location_x = 0;
 }
 
-static char *screen_get_framebuffer_line(unsigned char line)
-{
-    if (line < screen_dev.rows) {
-        return screen_dev.framebuffer[line];
-    }
-    return NULL;
-}
-
-static void screen_clear(void)
-{
-    for (unsigned char i = 0; i < screen_dev.rows; i++)
-        memset(screen_dev.framebuffer[i], 0,
-               sizeof(char) * (screen_dev.cols + 1));
-}
-
 static void screen_refresh(void *args)
 {
+    int first;
+
 #ifdef FREERTOS
     TickType_t xLastWakeTime = xTaskGetTickCount();
     TickType_t xPeriod = 20;
 
     while (1) {
-        xSemaphoreTake(screen_dev.framebuffer_lock, portMAX_DELAY);
+        // Only held while drawing into the back buffer, the frame is sent
+        // by the display driver after they are released
+        SCREEN_FB_LOCK();
         xSemaphoreTake(screen_dev.cursor_lock, portMAX_DELAY);
 #endif //FREERTOS
 
+#ifdef SCREEN_USE_CURSOR
+        first = screen_dev.cursor_location_y;
+#else
+        first = 0;
+#endif //SCREEN_USE_CURSOR
+        for (int i = first; i < first + screen_dev.rows; i++) {
+            screen_dev.view[i] = screen_get_framebuffer_line(i);
+        }
+
         (screen_dev.clear_screen)();
 
 #ifdef SCREEN_USE_CURSOR
-        screen_dev.draw_text(screen_dev.framebuffer,
+        screen_dev.draw_text(screen_dev.view,
                              screen_dev.cursor_on,
                              screen_dev.cursor_location_x,
                              screen_dev.cursor_location_y,
                              screen_dev.rows);
 #else
-        screen_dev.draw_text(screen_dev.framebuffer, 0, 0, 0, screen_dev.rows);
+        screen_dev.draw_text(screen_dev.view, 0, 0, 0, screen_dev.rows);
 #endif //SCREEN_USE_CURSOR
-        screen_dev.update_screen();
 #ifdef FREERTOS
         xSemaphoreGive(screen_dev.cursor_lock);
-        xSemaphoreGive(screen_dev.framebuffer_lock);
+        SCREEN_FB_UNLOCK();
+#endif //FREERTOS
+        screen_dev.update_screen();
+#ifdef FREERTOS
 
         xPeriod = SCREEN_PERIOD - (xLastWakeTime - xTaskGetTickCount());
         vTaskDelayUntil(&xLastWakeTime, xPeriod);
@@ -168,76 +267,49 @@ static void screen_refresh(void *args)
 #endif //SCREEN_USE_CURSOR
 }
 
-signed char screen_add_line_at_index(unsigned char index, char *line)
+static signed char screen_add_line_at_index_fb(unsigned char index, char *line)
 {
-    if (!line) {
+    if (!line || !screen_dev.lines) {
         return -1;
     }
 
-    if (index + 1 >= screen_dev.fb_row_count) {
-        screen_dev.framebuffer = reallocarray(
-                                     screen_dev.framebuffer, (index + 1), sizeof(char *));
-        if (!screen_dev.framebuffer) {
-            goto err_fb_realloc;
-        }
-        for (int i = screen_dev.fb_row_count; i <= index; i++) {
-            screen_dev.framebuffer[i] = NULL;
-        }
-        screen_dev.fb_row_count = index + 1;
-    }
-
-    screen_dev.framebuffer[index] = strdup(line);
-    if (!screen_dev.framebuffer[index]) {
-        goto err_line_alloc;
-    }
+    screen_set_line(screen_extend_to(index), line);
 
     return 0;
-err_line_alloc:
-    if (screen_dev.fb_row_count)
-        screen_dev.framebuffer =
-            reallocarray(screen_dev.framebuffer,
-                         (screen_dev.fb_row_count), sizeof(char *));
-    else {
-        free(screen_dev.framebuffer);
-    }
-err_fb_realloc:
-    return -1;
 }
 
-//Adds a line to the framebuffer and set's it's string contents
-signed char screen_add_line(char *line)
+signed char screen_add_line_at_index(unsigned char index, char *line)
 {
-    if (!line) {
-        return -1;
-    }
+    signed char ret;
 
-    screen_dev.framebuffer =
-        reallocarray(screen_dev.framebuffer,
-                     (screen_dev.fb_row_count + 1), sizeof(char *));
+    SCREEN_FB_LOCK();
+    ret = screen_add_line_at_index_fb(index, line);
+    SCREEN_FB_UNLOCK();
 
-    if (!screen_dev.framebuffer) {
-        goto err_fb_realloc;
-    }
+    return ret;
+}
 
-    screen_dev.framebuffer[screen_dev.fb_row_count] = strdup(line);
-    if (!screen_dev.framebuffer[screen_dev.fb_row_count]) {
-        goto err_line_alloc;
+//Adds a line to the framebuffer and set's it's string contents
+static signed char screen_add_line_fb(char *line)
+{
+    if (!line || !screen_dev.lines) {
+        return -1;
     }
 
-    screen_dev.fb_row_count++;
+    screen_set_line(screen_append_line(), line);
 
     return 0;
+}
 
-err_line_alloc:
-    if (screen_dev.fb_row_count)
-        screen_dev.framebuffer =
-            reallocarray(screen_dev.framebuffer,
-                         (screen_dev.fb_row_count), sizeof(char *));
-    else {
-        free(screen_dev.framebuffer);
-    }
-err_fb_realloc:
-    return -1;
+signed char screen_add_line(char *line)
+{
+    signed char ret;
+
+    SCREEN_FB_LOCK();
+    ret = screen_add_line_fb(line);
+    SCREEN_FB_UNLOCK();
+
+    return ret;
 }
 
 signed char screen_replace_line(char *line)
@@ -245,128 +317,155 @@ signed char screen_replace_line(char *line)
     return screen_replace_line_at_index(screen_dev.cursor_location_y, line);
 }
 
-signed char screen_replace_line_at_index(signed char index, char *line)
+static signed char screen_replace_line_at_index_fb(signed char index, char *line)
 {
-    if (screen_dev.framebuffer) {
-        if (index > (screen_dev.fb_row_count - 1)) {
-            return screen_add_line_at_index(index, line);
-        }
-
-        if (screen_dev.framebuffer[index]) {
-            free(screen_dev.framebuffer[index]);
-        }
-        screen_dev.framebuffer[index] = strdup(line);
-        if (!screen_dev.framebuffer[index]) {
-            return -1;
-        }
-        return 0;
+    if (!line || !screen_dev.lines || index < 0) {
+        return -1;
     }
-    else {
-        return screen_add_line_at_index(index, line);
+
+    if (index >= screen_dev.fb_row_count) {
+        return screen_add_line_at_index_fb(index, line);
     }
+
+    screen_set_line(index, line);
+
+    return 0;
+}
+
+signed char screen_replace_line_at_index(signed char index, char *line)
+{
+    signed char ret;
+
+    SCREEN_FB_LOCK();
+    ret = screen_replace_line_at_index_fb(index, line);
+    SCREEN_FB_UNLOCK();
+
+    return ret;
 }
 
 void screen_log_fb(void)
 {
+    SCREEN_FB_LOCK();
     ESP_LOGI(__func__, "#### %d lines ####", screen_dev.fb_row_count);
     for (int i = 0; i < screen_dev.fb_row_count; i++)
         ESP_LOGI(__func__, "#%d: '%s'", i,
-                 (screen_dev.framebuffer[i]) ?
-                 screen_dev.framebuffer[i] :
+                 (screen_get_framebuffer_line(i)) ?
+                 screen_get_framebuffer_line(i) :
                  "NULL");
+    SCREEN_FB_UNLOCK();
 }
 
-signed char screen_delete_line(void)
+// Deletes the last line along with any unset lines before it
+static signed char screen_delete_line_fb(void)
 {
-    if (screen_dev.framebuffer) {
-        if (screen_dev.fb_row_count) {
-            free(screen_dev
-                 .framebuffer[screen_dev.fb_row_count - 1]);
-            screen_dev.fb_row_count--;
-            while (screen_dev.framebuffer[screen_dev.fb_row_count -
-                                                                  1] == NULL) {
-                free(screen_dev.framebuffer
-                     [screen_dev.fb_row_count - 1]);
-                screen_dev.fb_row_count--;
-            }
-            screen_dev.framebuffer =
-                reallocarray(screen_dev.framebuffer,
-                             screen_dev.fb_row_count,
-                             sizeof(char *));
-            if (!screen_dev.fb_row_count) {
-                screen_dev.cursor_location_y = 0;
-                free(screen_dev.framebuffer);
-                return 0;
-            }
-            if (screen_dev.fb_row_count ==
-                screen_dev.cursor_location_y) {
-                screen_dev.cursor_location_y--;
-            }
-        }
-        else {
-            free(screen_dev.framebuffer);
-        }
+    if (!screen_dev.fb_row_count) {
+        return 0;
+    }
+
+    screen_dev.fb_row_count--;
+    while (screen_dev.fb_row_count &&
+           !screen_get_framebuffer_line(screen_dev.fb_row_count - 1)) {
+        screen_dev.fb_row_count--;
+    }
+
+    if (!screen_dev.fb_row_count) {
+        screen_dev.cursor_location_y = 0;
+    }
+    else if (screen_dev.cursor_location_y >= screen_dev.fb_row_count) {
+        screen_dev.cursor_location_y = screen_dev.fb_row_count - 1;
     }
 
     return 0;
 }
 
-signed char screen_delete_line_at_index(unsigned char index)
+signed char screen_delete_line(void)
 {
-    if (screen_dev.framebuffer)
-        if (index <= screen_dev.fb_row_count - 1) {
-            free(screen_dev.framebuffer[index]);
-            ESP_LOGI(__func__, "Index: %d, len: %d", index,
-                     screen_dev.fb_row_count);
-            if ((screen_dev.fb_row_count - 1) > index)
-                for (int i = index;
-                     i < (screen_dev.fb_row_count - 1); i++) {
-                    ESP_LOGI(__func__, "Moving %d -> %d",
-                             i + 1, i);
-                    screen_dev.framebuffer[i] =
-                        screen_dev.framebuffer[i + 1];
-                }
-            screen_dev.fb_row_count--;
-            screen_dev.framebuffer =
-                reallocarray(screen_dev.framebuffer,
-                             screen_dev.fb_row_count,
-                             sizeof(char *));
-            if (screen_dev.fb_row_count ==
-                screen_dev.cursor_location_y) {
-                screen_dev.cursor_location_y--;
-            }
-        }
+    signed char ret;
+
+    SCREEN_FB_LOCK();
+    ret = screen_delete_line_fb();
+    SCREEN_FB_UNLOCK();
+
+    return ret;
+}
+
+static signed char screen_delete_line_at_index_fb(unsigned char index)
+{
+    if (index >= screen_dev.fb_row_count) {
+        return 0;
+    }
+
+    for (int i = index; i < (screen_dev.fb_row_count - 1); i++) {
+        screen_copy_line(i, i + 1);
+    }
+    screen_dev.fb_row_count--;
+    if (screen_dev.cursor_location_y &&
+        screen_dev.fb_row_count == screen_dev.cursor_location_y) {
+        screen_dev.cursor_location_y--;
+    }
+
     return 0;
 }
+signed char screen_delete_line_at_index(unsigned char index)
+{
+    signed char ret;
+
+    SCREEN_FB_LOCK();
+    ret = screen_delete_line_at_index_fb(index);
+    SCREEN_FB_UNLOCK();
+
+    return ret;
+}
 
 signed char screen_write_string(char *str)
 {
     return screen_add_line_at_index(screen_dev.cursor_location_y, str);
 }
 
-signed char screen_write_string_at_index_and_pos(unsigned char index,
+static signed char screen_write_string_at_index_and_pos_fb(unsigned char index,
         unsigned int pos, char *str)
 {
-    if (!screen_dev.framebuffer || ((index + 1) > screen_dev.fb_row_count)) {
-        screen_add_line_at_index(index, "");
-        if (!screen_dev.framebuffer) {
-            return -1;
-        }
+    char *text;
+    size_t len;
+    int line;
+
+    if (!str || !screen_dev.lines) {
+        return -1;
     }
 
-    size_t str_len = strlen(str);
-    if (screen_dev.framebuffer[index]) {
-        if ((pos + str_len) != (strlen(screen_dev.framebuffer[index])))
-            screen_dev.framebuffer[index] =
-                reallocarray(screen_dev.framebuffer[index],
-                             pos + str_len, sizeof(char));
-        strcpy(screen_dev.framebuffer[index] + pos, str);
-        return 0;
+    line = screen_extend_to(index);
+    text = screen_line_text(line);
+    if (!screen_dev.line_set[screen_line_slot(line)]) {
+        text[0] = '\0';
     }
 
+    // Text is cut at the line length, gaps before pos are filled with spaces
+    len = strlen(text);
+    if (pos > screen_dev.line_len) {
+        pos = screen_dev.line_len;
+    }
+    if (pos > len) {
+        memset(text + len, ' ', pos - len);
+    }
+    strncpy(text + pos, str, screen_dev.line_len - pos);
+    text[screen_dev.line_len] = '\0';
+    screen_dev.line_set[screen_line_slot(line)] = 1;
+
     return 0;
 }
 
+signed char screen_write_string_at_index_and_pos(unsigned char index,
+        unsigned int pos, char *str)
+{
+    signed char ret;
+
+    SCREEN_FB_LOCK();
+    ret = screen_write_string_at_index_and_pos_fb(index, pos, str);
+    SCREEN_FB_UNLOCK();
+
+    return ret;
+}
+
 signed char screen_write_string_at_pos(unsigned int pos, char *str)
 {
     return screen_write_string_at_index_and_pos(
@@ -390,6 +489,20 @@ signed char screen_init(unsigned int verbose)
     ESP_LOGI(__func__, "Screen has %d cols and %d rows", screen_dev.rows,
              screen_dev.cols);
 
+    // All the text memory the screen will use, nothing is allocated later
+    screen_dev.line_len =
+        (screen_dev.cols > SCREEN_LINE_LEN) ? screen_dev.cols : SCREEN_LINE_LEN;
+    screen_dev.line_capacity = screen_dev.rows + SCREEN_SCROLLBACK;
+    screen_dev.lines =
+        malloc(screen_dev.line_capacity * (screen_dev.line_len + 1));
+    screen_dev.line_set = calloc(screen_dev.line_capacity, 1);
+    // Drawing can start up to rows past the last line
+    screen_dev.view = calloc(screen_dev.line_capacity + screen_dev.rows,
+                             sizeof(char *));
+    if (!screen_dev.lines || !screen_dev.line_set || !screen_dev.view) {
+        goto arena_error;
+    }
+
 #ifdef FREERTOS
     screen_dev.cursor_timer =
         xTimerCreate("Cursor Timer", screen_dev.cursor_period, 1, NULL,
@@ -425,6 +538,13 @@ f_lock_error:
 c_lock_error:
     xTimerDelete(screen_dev.cursor_timer, portMAX_DELAY);
 timer_error:
-    return -1;
 #endif
+arena_error:
+    free(screen_dev.view);
+    free(screen_dev.line_set);
+    free(screen_dev.lines);
+    screen_dev.view = NULL;
+    screen_dev.line_set = NULL;
+    screen_dev.lines = NULL;
+    return -1;
 }
@@ -16,6 +16,14 @@
 #ifndef SCREEN_PERIOD
 #define SCREEN_PERIOD (100)
 #endif //SCREEN_PERIOD
+// Lines are kept at least this long, longer ones are cut
+#ifndef SCREEN_LINE_LEN
+#define SCREEN_LINE_LEN (32)
+#endif //SCREEN_LINE_LEN
+// Lines kept beyond the ones that fit on the screen
+#ifndef SCREEN_SCROLLBACK
+#define SCREEN_SCROLLBACK (16)
+#endif //SCREEN_SCROLLBACK
 
 int screen_get_cursor_x(void);
 int screen_get_cursor_y(void);
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Builds the web asset pack that is flashed into the "www" partition and
+# served by main/paf_webserver.c, see main/paf_assets.h for the layout.
+#
+# Usage: mkassetpack.py [--size SIZE] [--immutable URI]... <output>
+#                       <uri> <file> <type> ...
+#
+# Every asset is gzipped reproducibly (no file name, zero mtime) so the
+# hash stored in the index, which the webserver uses as its ETag, only
+# changes when the asset does. Assets are revalidated against it on every
+# use unless marked --immutable, which is only safe for URIs that change
+# whenever their content does.
+
+import argparse
+import gzip
+import io
+import struct
+import sys
+
+PACK_MAGIC = 0x57464150  # "PAFW"
+PACK_VERSION = 1
+PACK_FLAG_GZIP = 0x1
+PACK_FLAG_IMMUTABLE = 0x2
+
+HEADER_FMT = "<IHHI"
+ENTRY_FMT = "<32s32sIIII"
+NAME_LEN = 32
+ALIGN = 4
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in bytearray(data):
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def compress(data):
+    buf = io.BytesIO()
+    with gzip.GzipFile(filename="", mode="wb", compresslevel=9,
+                       fileobj=buf, mtime=0) as gz:
+        gz.write(data)
+    return buf.getvalue()
+
+
+def field(s):
+    raw = s.encode("ascii")
+    if len(raw) >= NAME_LEN:
+        raise ValueError("'%s' is longer than %d characters" %
+                         (s, NAME_LEN - 1))
+    return raw
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--size", type=lambda x: int(x, 0), default=0,
+                        help="partition size, fail if the pack is larger")
+    parser.add_argument("--immutable", action="append", default=[],
+                        metavar="URI",
+                        help="let clients cache URI without revalidating")
+    parser.add_argument("output")
+    parser.add_argument("assets", nargs="+",
+                        help="triples of <uri> <file> <content type>")
+    args = parser.parse_args()
+
+    if len(args.assets) % 3:
+        parser.error("assets must be given as <uri> <file> <type> triples")
+
+    assets = []
+    for i in range(0, len(args.assets), 3):
+        uri, path, ctype = args.assets[i:i + 3]
+        flags = PACK_FLAG_GZIP
+        if uri in args.immutable:
+            flags |= PACK_FLAG_IMMUTABLE
+        with open(path, "rb") as f:
+            assets.append((field(uri), field(ctype), compress(f.read()),
+                           flags))
+
+    offset = struct.calcsize(HEADER_FMT) + \
+        len(assets) * struct.calcsize(ENTRY_FMT)
+    index = b""
+    blobs = b""
+    for uri, ctype, blob, flags in assets:
+        blobs += b"\0" * ((-(offset + len(blobs))) % ALIGN)
+        index += struct.pack(ENTRY_FMT, uri, ctype, offset + len(blobs),
+                             len(blob), fnv1a(blob), flags)
+        blobs += blob
+
+    size = offset + len(blobs)
+    if args.size and size > args.size:
+        sys.stderr.write("asset pack is %d bytes, partition only %d\n" %
+                         (size, args.size))
+        return 1
+
+    with open(args.output, "wb") as f:
+        f.write(struct.pack(HEADER_FMT, PACK_MAGIC, PACK_VERSION,
+                            len(assets), size))
+        f.write(index)
+        f.write(blobs)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
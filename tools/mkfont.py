@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+#
+# Converts the row-major font tables in main/fonts.c into the page-aligned
+# tables the SSD1306 driver blits, see main/fonts.h for the layout.
+#
+# Usage: mkfont.py <fonts.c> <output>
+#
+# fonts.c stays the editable source: one short per glyph row, the leftmost
+# pixel in bit 15, glyphs ' ' to '~'. Every glyph is emitted as FontWidth
+# columns of (FontHeight + 7) / 8 bytes, least significant bit on top, the
+# same way the display's RAM is laid out.
+
+import re
+import sys
+
+FIRST_CHAR = 32
+LAST_CHAR = 126
+
+TABLE_RE = re.compile(r"static\s+const\s+short\s+(\w+)\s*\[\]\s*=\s*\{(.*?)\};",
+                      re.S)
+FONTDEF_RE = re.compile(r"FontDef\s+(\w+)\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,"
+                        r"\s*(\w+)\s*\};")
+COMMENT_RE = re.compile(r"//[^\n]*|/\*.*?\*/", re.S)
+
+
+def parse_table(body):
+    body = COMMENT_RE.sub("", body)
+    return [int(v, 0) for v in body.replace(",", " ").split()]
+
+
+def convert(rows, width, height):
+    pages = (height + 7) // 8
+    out = []
+    for col in range(width):
+        bits = 0
+        for row in range(height):
+            if rows[row] & (0x8000 >> col):
+                bits |= 1 << row
+        for page in range(pages):
+            out.append((bits >> (8 * page)) & 0xFF)
+    return out
+
+
+def glyph_name(ch):
+    # A trailing backslash would continue the comment onto the next line
+    return {" ": "sp", "\\": "backslash"}.get(ch, ch)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write("usage: %s <fonts.c> <output>\n" % sys.argv[0])
+        return 1
+
+    with open(sys.argv[1]) as f:
+        src = f.read()
+
+    tables = dict((m.group(1), parse_table(m.group(2)))
+                  for m in TABLE_RE.finditer(src))
+    fonts = [(m.group(1), int(m.group(2)), int(m.group(3)), m.group(4))
+             for m in FONTDEF_RE.finditer(src)]
+    if not fonts:
+        sys.stderr.write("%s: no FontDef found\n" % sys.argv[1])
+        return 1
+
+    glyphs = LAST_CHAR - FIRST_CHAR + 1
+    lines = ["// Generated by tools/mkfont.py from main/fonts.c, do not edit",
+             "",
+             "#include \"fonts.h\"",
+             ""]
+    for name, width, height, table in fonts:
+        if width > 16 or height > 32:
+            sys.stderr.write("%s: %dx%d is larger than 16x32\n" %
+                             (name, width, height))
+            return 1
+        rows = tables.get(table)
+        if rows is None or len(rows) != glyphs * height:
+            sys.stderr.write("%s: %s should hold %d rows\n" %
+                             (name, table, glyphs * height))
+            return 1
+
+        lines.append("static const unsigned char %s[] = {" % table)
+        for i in range(glyphs):
+            data = convert(rows[i * height:(i + 1) * height], width, height)
+            lines.append("    %s, // %s" %
+                         (", ".join("0x%02X" % b for b in data),
+                          glyph_name(chr(FIRST_CHAR + i))))
+        lines.append("};")
+        lines.append("")
+
+    for name, width, height, table in fonts:
+        lines.append("FontDef %s = {%d, %d, %s};" % (name, width, height, table))
+
+    with open(sys.argv[2], "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
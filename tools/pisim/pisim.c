@@ -0,0 +1,366 @@
+/**
+ * @file pisim.c
+ * @date 16 October 2026
+ * @brief Host simulation of the optical output regulation, see paf_ctrl.h
+ *
+ * Runs the loop of main/paf_pi.c, the one paf_ctrl.c runs, with the gains
+ * and rates of main/paf_config.h against a model of the LED, its photodiode
+ * amplifier and the ADC:
+ *
+ * - the LED is PWM driven at PAF_DEF_LED_FREQ, duty cycle changes take
+ *   effect at the next period
+ * - its efficiency drops with the junction temperature, which follows the
+ *   dissipated power with a thermal time constant, and with aging
+ * - the photodiode amplifier low pass filters the light
+ * - the ADC adds noise and quantizes to 12 bits at PAF_CTRL_SAMPLE_RATE
+ *
+ * The scenario calibrates on a cold LED and then steps the duty cycle down
+ * while the LED warms up, and ages the LED later on. The output error
+ * against the calibrated output is reported for every phase, once settled,
+ * along with the error open loop drive would have had, and how often the
+ * trim changed, each change being a commit of the duty cycles.
+ *
+ * -m also runs the scenario with the gains doubled until the rms error of
+ * a phase exceeds the limit, the last scale within it is the gain margin. -b times the controller step.
+ * The exit status is 0 if every phase stays within the error limit.
+ *
+ * Usage: pisim [-k <gain scale>] [-m] [-b] [-o <trace.csv>]
+ *
+ * @verbatim
+   ----------------------------------------------------------------------
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#define _XOPEN_SOURCE 700
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "paf_config.h"
+#include "paf_pi.h"
+
+#define DC_MAX 1000000
+#define SIM_DT 1e-6 // s
+#define SAMPLE_TICKS (1000000 / PAF_CTRL_SAMPLE_RATE)
+#define STEP_US (1000000 / PAF_CTRL_RATE)
+#define SETTLE_S 0.2 // Not scored after every phase change
+// Scored on the output over this many steps, a single step may not hold a
+// whole number of PWM periods
+#define SCORE_STEPS 20
+#define ERROR_LIMIT_PPM 5000
+#define BENCH_STEPS 1000000
+
+// Plant
+#define ADC_FULL_SCALE 3600.0 // Counts at full duty cycle, cold and new
+#define ADC_NOISE 4.0 // Counts rms
+#define PD_TAU 0.5e-3 // s
+#define THERMAL_TAU 3.0 // s
+#define THERMAL_RISE 50.0 // K at full duty cycle
+#define EFFICIENCY_TEMPCO -0.004 // Per K
+
+struct phase {
+    double start; /**< s */
+    uint32_t dc; /**< ppm */
+    double aging; /**< Efficiency left */
+    const char *name;
+};
+
+static const struct phase phases[] = {
+    { 0.0, 500000, 1.0, "50 %, warming up" },
+    { 4.0, 100000, 1.0, "10 %, cooling down" },
+    { 6.0, 20000, 1.0, "2 %" },
+    { 8.0, 20000, 0.95, "2 %, aged 5 %" },
+    { 10.0, 500000, 0.95, "50 %, aged 5 %" },
+};
+
+#define PHASES (sizeof(phases) / sizeof(phases[0]))
+#define SIM_END 14.0 // s
+
+struct score {
+    double sum_sq;
+    double max;
+    double open_max;
+    unsigned int n;
+};
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static double rng_uniform(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+
+    return ((rng_state >> 11) + 0.5) / (double)(1ull << 53);
+}
+
+static double rng_gauss(void)
+{
+    return sqrt(-2 * log(rng_uniform())) * cos(2 * M_PI * rng_uniform());
+}
+
+/**
+ * @brief Mean of n samples in 1/16 counts, as paf_ctrl.c
+ */
+static uint32_t average(const uint16_t *samples, size_t n)
+{
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        sum += samples[i] & 0xFFF;
+    }
+
+    return n ? (sum << 4) / n : 0;
+}
+
+static uint32_t trim_dc(uint32_t dc, int32_t trim)
+{
+    int64_t trimmed = dc + (int64_t)dc * trim / DC_MAX;
+
+    return trimmed < 0 ? 0 : trimmed > DC_MAX ? DC_MAX : trimmed;
+}
+
+/**
+ * @brief Returns how long the LED is on within [from, to) of a period, us
+ */
+static double on_time(double from, double to, uint32_t duty, double period)
+{
+    double on = (double)duty * period / DC_MAX;
+
+    return to < on ? to - from : on > from ? on - from : 0;
+}
+
+/**
+ * @brief Runs the scenario with the gains scaled by scale, returns 0 if
+ * every phase stays within ERROR_LIMIT_PPM. The worst rms error of a phase
+ * is returned in worst_rms
+ */
+static int simulate(double scale, FILE *trace, int verbose,
+                    double *worst_rms)
+{
+    struct score scores[PHASES] = { 0 };
+    uint16_t samples[PAF_CTRL_SAMPLES_PER_STEP];
+    unsigned int n = 0, ph = 0, steps = 0;
+    double period = 1e6 / PAF_DEF_LED_FREQ, pos = 0; // us
+    uint32_t dc = phases[0].dc, duty = 0, next_duty = 0;
+    uint32_t measured, commits = 0, loop_steps = 0;
+    int32_t trim = 0, last_trim = 0;
+    double temp = 0, pd = 0, light_sum = 0, eta_cal = 0, eta = 1;
+    double light, err, open_err, rms, t;
+    paf_pi_loop_t loop;
+    int ret = 0;
+
+    rng_state = 0x9E3779B97F4A7C15ull;
+    paf_pi_loop_init(&loop, PAF_CTRL_KP * scale, PAF_CTRL_KI * scale);
+    paf_pi_loop_enable(&loop, 1);
+    if (trace) {
+        fprintf(trace, "t,dc,trim,setpoint,measured,error_ppm,"
+                "open_loop_error_ppm\n");
+    }
+
+    for (uint64_t tick = 0; (t = tick * SIM_DT) < SIM_END; tick++) {
+        if (ph + 1 < PHASES && t >= phases[ph + 1].start) {
+            ph++;
+            dc = phases[ph].dc;
+        }
+
+        // Share of the tick the LED is on, new duty cycles wait for the
+        // next period
+        eta = (1 + EFFICIENCY_TEMPCO * temp) * phases[ph].aging;
+        if (pos + SIM_DT * 1e6 < period) {
+            light = on_time(pos, pos + SIM_DT * 1e6, duty, period);
+            pos += SIM_DT * 1e6;
+        }
+        else {
+            light = on_time(pos, period, duty, period);
+            pos += SIM_DT * 1e6 - period;
+            duty = next_duty;
+            light += on_time(0, pos, duty, period);
+        }
+        light *= eta / (SIM_DT * 1e6);
+        temp += ((double)duty / DC_MAX * THERMAL_RISE - temp) * SIM_DT /
+                THERMAL_TAU;
+        pd += (light - pd) * SIM_DT / PD_TAU;
+        light_sum += light;
+
+        if (tick % SAMPLE_TICKS) {
+            continue;
+        }
+        err = pd * ADC_FULL_SCALE + ADC_NOISE * rng_gauss();
+        samples[n++] = err < 0 ? 0 : err > 4095 ? 4095 : lround(err);
+        if (n < PAF_CTRL_SAMPLES_PER_STEP) {
+            continue;
+        }
+        n = 0;
+
+        // The loop step of paf_ctrl.c
+        measured = average(samples, PAF_CTRL_SAMPLES_PER_STEP);
+        trim = paf_pi_loop_step(&loop, measured, dc, 1);
+        if (loop.ref && !eta_cal) {
+            eta_cal = eta;
+        }
+        commits += trim != last_trim;
+        last_trim = trim;
+        loop_steps++;
+        next_duty = trim_dc(dc, trim);
+
+        // Scored against the calibrated output
+        if (++steps < SCORE_STEPS) {
+            continue;
+        }
+        light = light_sum / (SCORE_STEPS * STEP_US);
+        light_sum = 0;
+        steps = 0;
+        if (!eta_cal || !dc) {
+            continue;
+        }
+        err = (light / (eta_cal * dc / DC_MAX) - 1) * 1e6;
+        open_err = (eta / eta_cal - 1) * 1e6;
+        if (t >= phases[ph].start + SETTLE_S) {
+            scores[ph].sum_sq += err * err;
+            scores[ph].n++;
+            if (fabs(err) > scores[ph].max) {
+                scores[ph].max = fabs(err);
+            }
+            if (fabs(open_err) > scores[ph].open_max) {
+                scores[ph].open_max = fabs(open_err);
+            }
+        }
+        if (trace) {
+            fprintf(trace, "%.3f,%u,%d,%u,%u,%.0f,%.0f\n", t, dc, trim,
+                    loop.setpoint, measured, err, open_err);
+        }
+    }
+
+    if (verbose) {
+        printf("Trim changed on %.1f %% of the steps\n",
+               100.0 * commits / loop_steps);
+    }
+    *worst_rms = 0;
+    for (unsigned int i = 0; i < PHASES; i++) {
+        rms = scores[i].n ? sqrt(scores[i].sum_sq / scores[i].n) : 0;
+        if (rms > *worst_rms) {
+            *worst_rms = rms;
+        }
+        if (scores[i].max > ERROR_LIMIT_PPM) {
+            ret = 1;
+        }
+        if (verbose) {
+            printf("%-20s error rms %6.0f ppm, max %6.0f ppm, "
+                   "open loop max %6.0f ppm%s\n", phases[i].name, rms,
+                   scores[i].max, scores[i].open_max,
+                   scores[i].max > ERROR_LIMIT_PPM ? "  FAIL" : "");
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Times the work of one loop step on the host
+ */
+static void bench(void)
+{
+    static uint16_t samples[PAF_CTRL_SAMPLES_PER_STEP];
+    struct timespec start, end;
+    volatile int32_t sink = 0;
+    paf_pi_loop_t loop;
+    double ns;
+
+    for (unsigned int i = 0; i < PAF_CTRL_SAMPLES_PER_STEP; i++) {
+        samples[i] = 1800 + (i & 7);
+    }
+    // Calibrated and regulating, a setpoint of 28800 at 50 %
+    paf_pi_loop_init(&loop, PAF_CTRL_KP, PAF_CTRL_KI);
+    paf_pi_loop_enable(&loop, 1);
+    loop.calibrating = 0;
+    loop.ref = 57600;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned int i = 0; i < BENCH_STEPS; i++) {
+        samples[i % PAF_CTRL_SAMPLES_PER_STEP] ^= 1;
+        sink += paf_pi_loop_step(&loop, average(samples,
+                                                PAF_CTRL_SAMPLES_PER_STEP),
+                                 500000, 1);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    ns = ((end.tv_sec - start.tv_sec) * 1e9 +
+          (end.tv_nsec - start.tv_nsec)) / BENCH_STEPS;
+    printf("Step: %.1f ns on this host, %.4f %% of the %u us period "
+           "(ctrl on the target reports its cycles)\n", ns,
+           ns / (STEP_US * 10.0), STEP_US);
+}
+
+int main(int argc, char **argv)
+{
+    FILE *trace = NULL;
+    double scale = 1, rms;
+    int margin = 0, benchmark = 0, opt, ret;
+
+    while ((opt = getopt(argc, argv, "k:mbo:")) != -1) {
+        switch (opt) {
+            case 'k':
+                scale = atof(optarg);
+                break;
+            case 'm':
+                margin = 1;
+                break;
+            case 'b':
+                benchmark = 1;
+                break;
+            case 'o':
+                if (!(trace = fopen(optarg, "w"))) {
+                    perror(optarg);
+                    return 2;
+                }
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-k <gain scale>] [-m] [-b] "
+                        "[-o <trace.csv>]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    printf("kp %.3f, ki %.3f, %u Hz loop, %u samples per step\n",
+           PAF_CTRL_KP * scale / PAF_PI_ONE, PAF_CTRL_KI * scale / PAF_PI_ONE,
+           PAF_CTRL_RATE, PAF_CTRL_SAMPLES_PER_STEP);
+    ret = simulate(scale, trace, 1, &rms);
+    if (trace) {
+        fclose(trace);
+    }
+
+    if (margin) {
+        double k = scale;
+
+        // Noise alone may exceed the limit at dim levels, an unstable loop
+        // does so on average
+        do {
+            k *= 2;
+            simulate(k, NULL, 0, &rms);
+        } while (k < 1024 && rms <= ERROR_LIMIT_PPM);
+        printf("Gain margin: stable up to %gx the gains\n", k / 2 / scale);
+    }
+    if (benchmark) {
+        bench();
+    }
+    printf("%s\n", ret ? "FAIL" : "PASS");
+
+    return ret;
+}